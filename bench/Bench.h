@@ -0,0 +1,71 @@
+#ifndef _STD_EXT_BENCH_H_
+#define _STD_EXT_BENCH_H_
+
+#include <StdExt/Chrono/Stopwatch.h>
+#include <StdExt/Concepts.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+namespace StdExt::Bench
+{
+	/**
+	 * @brief
+	 *  Prevents the compiler from optimizing away the computation of <i>value</i>.
+	 */
+	inline const void* volatile keepSink = nullptr;
+	inline volatile uint64_t keepValueSink = 0;
+
+	template<typename T>
+	void keep(const T& value)
+	{
+		if constexpr ( std::is_arithmetic_v<T> )
+			keepValueSink = static_cast<uint64_t>(value);
+		else
+			keepSink = &value;
+	}
+
+	/**
+	 * @brief
+	 *  Runs <i>func</i> the specified number of iterations, reporting the
+	 *  total time and the time per iteration.
+	 */
+	template<CallableWith<void> func_t>
+	std::chrono::nanoseconds measure(const std::string& title, size_t iterations, func_t&& func)
+	{
+		using namespace std::chrono;
+
+		Chrono::Stopwatch stopwatch;
+		stopwatch.start();
+
+		for (size_t i = 0; i < iterations; ++i)
+			func();
+
+		stopwatch.stop();
+
+		auto total = duration_cast<nanoseconds>(stopwatch.time());
+		double per_iteration = static_cast<double>(total.count()) / static_cast<double>(iterations);
+
+		std::cout << std::left << std::setw(60) << title <<
+			std::right << std::setw(14) << std::fixed << std::setprecision(3) <<
+			duration_cast<duration<double, std::milli>>(total).count() << " ms" <<
+			std::setw(14) << std::setprecision(1) << per_iteration << " ns/iter" << std::endl;
+
+		return total;
+	}
+
+	/**
+	 * @brief
+	 *  Prints a header for a group of related measurements.
+	 */
+	inline void section(const std::string& title)
+	{
+		std::cout << "\n== " << title << " ==" << std::endl;
+	}
+}
+
+#endif // !_STD_EXT_BENCH_H_
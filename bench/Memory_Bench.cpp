@@ -0,0 +1,484 @@
+#include "Bench.h"
+
+#include <StdExt/Collections/SharedArray.h>
+#include <StdExt/Collections/Vector.h>
+#include <StdExt/Memory/Arena.h>
+#include <StdExt/Memory/IntrusivePtr.h>
+#include <StdExt/Memory/ObjectPool.h>
+#include <StdExt/Memory/SharedData.h>
+#include <StdExt/Memory/SharedPtr.h>
+#include <StdExt/String.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace StdExt;
+using namespace StdExt::Bench;
+using namespace StdExt::Collections;
+
+namespace
+{
+	constexpr size_t CopyCount = 1024;
+	constexpr size_t ThreadCount = 4;
+	constexpr size_t GraphSize = 64 * 1024;
+	constexpr size_t ArenaObjectCount = 1024;
+
+	struct EventData
+	{
+		uint64_t id = 0;
+		uint64_t payload[3] = {};
+	};
+
+	template<ReferenceCounter ref_count_t>
+	struct IntrusiveEvent : public EventData, public IntrusiveRefCounted<IntrusiveEvent<ref_count_t>, ref_count_t>
+	{
+	};
+
+	/**
+	 * @brief
+	 *  Copies every reference in <i>sources</i>, which are in random order, reading
+	 *  each object through its copy, and then releases the copies.
+	 */
+	template<typename ptr_t>
+	uint64_t copyGraph(const std::vector<ptr_t>& sources, std::vector<ptr_t>& copies)
+	{
+		uint64_t sum = 0;
+
+		for (size_t i = 0; i < sources.size(); ++i)
+		{
+			copies[i] = sources[i];
+			sum += copies[i]->id;
+		}
+
+		for (auto& copy : copies)
+			copy = ptr_t();
+
+		return sum;
+	}
+
+	template<typename ptr_t, typename make_t>
+	void benchGraph(const std::string& title, const make_t& make)
+	{
+		std::vector<ptr_t> sources;
+		sources.reserve(GraphSize);
+
+		for (size_t i = 0; i < GraphSize; ++i)
+		{
+			sources.push_back(make());
+			sources.back()->id = i;
+		}
+
+		std::shuffle(sources.begin(), sources.end(), std::mt19937_64(11));
+
+		std::vector<ptr_t> copies(GraphSize);
+
+		measure(title, 100, [&]()
+			{
+				keep(copyGraph(sources, copies));
+			}
+		);
+	}
+
+	/**
+	 * @brief
+	 *  Copies <i>original</i> into each slot of <i>copies</i>, and then releases
+	 *  all of the copies.
+	 */
+	template<typename ptr_t>
+	void copyAndRelease(const ptr_t& original, std::vector<ptr_t>& copies)
+	{
+		for (auto& copy : copies)
+			copy = original;
+
+		for (auto& copy : copies)
+			copy = ptr_t();
+	}
+
+	/**
+	 * @brief
+	 *  Runs copyAndRelease() on ThreadCount threads at once, each copying the object
+	 *  returned by calling <i>make</i> on that thread.
+	 */
+	template<typename make_t>
+	void copyOnThreads(const make_t& make)
+	{
+		std::vector<std::thread> threads;
+
+		for (size_t t = 0; t < ThreadCount; ++t)
+		{
+			threads.emplace_back(
+				[&]()
+				{
+					auto source = make();
+					std::vector<decltype(source)> copies(CopyCount);
+
+					for (size_t i = 0; i < 1000; ++i)
+						copyAndRelease(source, copies);
+				}
+			);
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+	template<typename atomic_t, typename local_t>
+	void benchPolicies(const std::string& label, const atomic_t& atomic_original, const local_t& local_original)
+	{
+		std::string count_label = std::to_string(CopyCount) + " copies";
+
+		{
+			std::vector<atomic_t> copies(CopyCount);
+
+			measure(label + " AtomicRefCount - " + count_label, 1000, [&]()
+				{
+					copyAndRelease(atomic_original, copies);
+				}
+			);
+		}
+
+		{
+			std::vector<local_t> copies(CopyCount);
+
+			measure(label + " LocalRefCount - " + count_label, 1000, [&]()
+				{
+					copyAndRelease(local_original, copies);
+				}
+			);
+		}
+	}
+
+	/**
+	 * @brief
+	 *  Measures copies of an atomically counted object shared by all threads, which
+	 *  contend on its reference count, against objects created on each thread.
+	 */
+	template<typename make_atomic_t, typename make_local_t>
+	void benchContention(const std::string& label, const make_atomic_t& make_atomic, const make_local_t& make_local)
+	{
+		std::string thread_label = std::to_string(ThreadCount) + " threads";
+		auto shared = make_atomic();
+
+		measure(label + " AtomicRefCount, shared - " + thread_label, 1, [&]()
+			{
+				copyOnThreads([&]() { return shared; });
+			}
+		);
+
+		measure(label + " AtomicRefCount, per thread - " + thread_label, 1, [&]()
+			{
+				copyOnThreads(make_atomic);
+			}
+		);
+
+		measure(label + " LocalRefCount, per thread - " + thread_label, 1, [&]()
+			{
+				copyOnThreads(make_local);
+			}
+		);
+	}
+
+	/**
+	 * @brief
+	 *  Measures creating and destroying ArenaObjectCount containers returned by calling
+	 *  <i>make</i> with the global heap, and with a MonotonicArena that is reset after
+	 *  each iteration.
+	 */
+	template<typename make_t>
+	void benchArena(const std::string& label, const make_t& make)
+	{
+		using object_t = decltype(make(Allocator::heap()));
+
+		std::string count_label = std::to_string(ArenaObjectCount) + " objects";
+
+		auto build = [&](Allocator& allocator)
+		{
+			std::vector<object_t> objects;
+			objects.reserve(ArenaObjectCount);
+
+			for (size_t i = 0; i < ArenaObjectCount; ++i)
+				objects.push_back(make(allocator));
+
+			keep(objects.back());
+		};
+
+		measure(label + " global heap - " + count_label, 1000, [&]()
+			{
+				build(Allocator::heap());
+			}
+		);
+
+		MonotonicArena arena(64 * 1024);
+
+		measure(label + " MonotonicArena - " + count_label, 1000, [&]()
+			{
+				build(arena);
+				arena.reset();
+			}
+		);
+	}
+}
+
+void benchMemory()
+{
+	section("Reference Counting");
+
+	SharedArray<char8_t> atomic_array(64, u8'a');
+	SharedArray<char8_t, LocalRefCount> local_array(64, u8'a');
+
+	benchPolicies("SharedArray", atomic_array, local_array);
+
+	SharedData<> atomic_data(64);
+	SharedData<void, LocalRefCount> local_data(64);
+
+	benchPolicies("SharedData", atomic_data, local_data);
+
+	auto atomic_ptr = SharedPtr<uint64_t>::make(1);
+	auto local_ptr = SharedPtr<uint64_t, LocalRefCount>::make(1);
+
+	benchPolicies("SharedPtr", atomic_ptr, local_ptr);
+
+	section("Reference Counting Contention");
+
+	benchContention(
+		"SharedArray",
+		[]() { return SharedArray<char8_t>(64, u8'a'); },
+		[]() { return SharedArray<char8_t, LocalRefCount>(64, u8'a'); }
+	);
+
+	benchContention(
+		"SharedPtr",
+		[]() { return SharedPtr<uint64_t>::make(1); },
+		[]() { return SharedPtr<uint64_t, LocalRefCount>::make(1); }
+	);
+
+	section("Intrusive Reference Counting");
+
+	std::string graph_label = std::to_string(GraphSize / 1024) + "K objects";
+
+	benchGraph<SharedPtr<EventData>>(
+		"SharedPtr copy and read - " + graph_label,
+		[]() { return makeShared<EventData>(); }
+	);
+
+	benchGraph<IntrusivePtr<IntrusiveEvent<AtomicRefCount>>>(
+		"IntrusivePtr AtomicRefCount copy and read - " + graph_label,
+		[]() { return makeIntrusive<IntrusiveEvent<AtomicRefCount>>(); }
+	);
+
+	benchGraph<SharedPtr<EventData, LocalRefCount>>(
+		"SharedPtr LocalRefCount copy and read - " + graph_label,
+		[]() { return makeShared<EventData, LocalRefCount>(); }
+	);
+
+	benchGraph<IntrusivePtr<IntrusiveEvent<LocalRefCount>>>(
+		"IntrusivePtr LocalRefCount copy and read - " + graph_label,
+		[]() { return makeIntrusive<IntrusiveEvent<LocalRefCount>>(); }
+	);
+
+	section("Shared Pointer Creation and Weak References");
+
+	measure("makeShared<uint64_t>() - 1024 objects", 1000, [&]()
+		{
+			std::vector<SharedPtr<uint64_t>> objects(CopyCount);
+
+			for (size_t i = 0; i < CopyCount; ++i)
+				objects[i] = makeShared<uint64_t>(i);
+
+			keep(*objects.back());
+		}
+	);
+
+	measure("std::make_shared<uint64_t>() - 1024 objects", 1000, [&]()
+		{
+			std::vector<std::shared_ptr<uint64_t>> objects(CopyCount);
+
+			for (size_t i = 0; i < CopyCount; ++i)
+				objects[i] = std::make_shared<uint64_t>(i);
+
+			keep(*objects.back());
+		}
+	);
+
+	WeakPtr<uint64_t> weak_ptr = atomic_ptr;
+	auto std_ptr = std::make_shared<uint64_t>(1);
+	std::weak_ptr<uint64_t> std_weak_ptr = std_ptr;
+
+	measure("WeakPtr::lock() - 1024 locks", 1000, [&]()
+		{
+			uint64_t sum = 0;
+
+			for (size_t i = 0; i < CopyCount; ++i)
+				sum += *weak_ptr.lock();
+
+			keep(sum);
+		}
+	);
+
+	measure("std::weak_ptr::lock() - 1024 locks", 1000, [&]()
+		{
+			uint64_t sum = 0;
+
+			for (size_t i = 0; i < CopyCount; ++i)
+				sum += *std_weak_ptr.lock();
+
+			keep(sum);
+		}
+	);
+
+	section(
+		Config::PooledAlloc ?
+			"alloc_aligned() with STD_EXT_POOLED_ALLOC" :
+			"alloc_aligned() without STD_EXT_POOLED_ALLOC"
+	);
+
+	{
+		std::vector<void*> blocks(CopyCount);
+
+		measure("alloc_aligned() then free_aligned() - 1024 blocks of 16-256 bytes", 1000, [&]()
+			{
+				for (size_t i = 0; i < CopyCount; ++i)
+					blocks[i] = alloc_aligned(16 + (i * 37) % 241, 8);
+
+				for (void* block : blocks)
+					free_aligned(block);
+			}
+		);
+
+		measure("alloc_aligned() on one thread, free_aligned() on another - 1024 blocks", 100, [&]()
+			{
+				std::thread(
+					[&]()
+					{
+						for (size_t i = 0; i < CopyCount; ++i)
+							blocks[i] = alloc_aligned(64, 8);
+					}
+				).join();
+
+				for (void* block : blocks)
+					free_aligned(block);
+			}
+		);
+
+		measure("SharedArray<char8_t>(40) creation - 1024 arrays", 1000, [&]()
+			{
+				std::vector<SharedArray<char8_t>> arrays(CopyCount);
+
+				for (size_t i = 0; i < CopyCount; ++i)
+					arrays[i] = SharedArray<char8_t>(40, u8'a');
+
+				keep(arrays.back());
+			}
+		);
+	}
+
+	section("Monotonic Arena");
+
+	benchArena(
+		"SharedArray<uint64_t>(8)",
+		[](Allocator& allocator) { return SharedArray<uint64_t>(allocator, 8, 1); }
+	);
+
+	benchArena(
+		"String(48 chars)",
+		[](Allocator& allocator)
+		{
+			return String(std::u8string_view(u8"A string that is too long for small memory......"), allocator);
+		}
+	);
+
+	benchArena(
+		"Vector<uint32_t> 32 emplace_back()",
+		[](Allocator& allocator)
+		{
+			Vector<uint32_t, 0> vec(allocator);
+
+			for (uint32_t i = 0; i < 32; ++i)
+				vec.emplace_back(i);
+
+			return vec;
+		}
+	);
+
+	section("Object Pool");
+
+	{
+		struct Record
+		{
+			uint64_t values[6];
+		};
+
+		constexpr size_t ThreadCount = 4;
+
+		std::vector<Record*> records(CopyCount);
+		ObjectPool<Record> pool;
+
+		auto churn = [&](const auto& create, const auto& destroy)
+		{
+			std::vector<Record*> local(CopyCount);
+
+			for (size_t round = 0; round < 16; ++round)
+			{
+				for (size_t i = 0; i < CopyCount; ++i)
+					local[i] = create();
+
+				for (Record* record : local)
+					destroy(record);
+			}
+		};
+
+		auto onThreads = [&](const auto& create, const auto& destroy)
+		{
+			std::vector<std::thread> threads;
+
+			for (size_t t = 0; t < ThreadCount; ++t)
+				threads.emplace_back([&]() { churn(create, destroy); });
+
+			for (auto& thread : threads)
+				thread.join();
+		};
+
+		auto heapCreate = []() { return new Record{}; };
+		auto heapDestroy = [](Record* record) { delete record; };
+		auto poolCreate = [&]() { return pool.create(); };
+		auto poolDestroy = [&](Record* record) { pool.destroy(record); };
+
+		measure("new then delete - 1024 objects", 1000, [&]()
+			{
+				for (size_t i = 0; i < CopyCount; ++i)
+					records[i] = heapCreate();
+
+				for (Record* record : records)
+					heapDestroy(record);
+			}
+		);
+
+		measure("ObjectPool::create() then destroy() - 1024 objects", 1000, [&]()
+			{
+				for (size_t i = 0; i < CopyCount; ++i)
+					records[i] = poolCreate();
+
+				for (Record* record : records)
+					poolDestroy(record);
+			}
+		);
+
+		std::string thread_label = std::to_string(ThreadCount) + " threads, 16 x 1024 objects each";
+
+		measure("new then delete - " + thread_label, 20, [&]()
+			{
+				onThreads(heapCreate, heapDestroy);
+			}
+		);
+
+		measure("ObjectPool::create() then destroy() - " + thread_label, 20, [&]()
+			{
+				onThreads(poolCreate, poolDestroy);
+			}
+		);
+	}
+}
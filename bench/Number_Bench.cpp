@@ -0,0 +1,87 @@
+#include "Bench.h"
+
+#include <StdExt/Number.h>
+#include <StdExt/String.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace StdExt;
+using namespace StdExt::Bench;
+
+void benchNumber()
+{
+	section("Number Parsing");
+
+	std::mt19937_64 random(7);
+	std::uniform_int_distribution<int64_t> int_values(-1000000000000, 1000000000000);
+	std::uniform_real_distribution<double> float_values(-1.0e6, 1.0e6);
+
+	std::vector<String> int_strings;
+	std::vector<String> float_strings;
+
+	for (size_t i = 0; i < 4096; ++i)
+	{
+		int_strings.push_back(Number(int_values(random)).toString());
+		float_strings.push_back(Number(float_values(random)).toString());
+	}
+
+	std::vector<std::u8string_view> float_views;
+
+	for (const auto& str : float_strings)
+		float_views.push_back(str.view());
+
+	measure("Number::parse() - 4096 integers", 1000, [&]()
+		{
+			int64_t sum = 0;
+
+			for (const auto& str : int_strings)
+				sum += Number::parse(str).value<int64_t>();
+
+			keep(sum);
+		}
+	);
+
+	measure("std::stoll(std::wstring) - 4096 integers", 1000, [&]()
+		{
+			int64_t sum = 0;
+
+			for (const auto& str : int_strings)
+				sum += std::stoll(convertString<wchar_t>(str).toStdString());
+
+			keep(sum);
+		}
+	);
+
+	measure("Number::parse() - 4096 floats", 1000, [&]()
+		{
+			double sum = 0.0;
+
+			for (const auto& str : float_strings)
+				sum += Number::parse(str).value<float64_t>();
+
+			keep(sum);
+		}
+	);
+
+	measure("std::stod(std::wstring) - 4096 floats", 1000, [&]()
+		{
+			double sum = 0.0;
+
+			for (const auto& str : float_strings)
+				sum += std::stod(convertString<wchar_t>(str).toStdString());
+
+			keep(sum);
+		}
+	);
+
+	std::vector<Number> parsed(float_views.size());
+
+	measure("Number::parse(span) - 4096 floats", 1000, [&]()
+		{
+			Number::parse(float_views, parsed);
+			keep(parsed.back().value<float64_t>());
+		}
+	);
+}
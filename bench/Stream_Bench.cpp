@@ -0,0 +1,371 @@
+#include "Bench.h"
+
+#include <StdExt/Buffer.h>
+#include <StdExt/Memory/SharedData.h>
+#include <StdExt/Streams/AsyncFileIO.h>
+#include <StdExt/Streams/BufferedStream.h>
+#include <StdExt/Streams/FdFileStream.h>
+#include <StdExt/Streams/FileStream.h>
+#include <StdExt/Streams/MappedFileStream.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace StdExt;
+using namespace StdExt::Bench;
+using namespace StdExt::Streams;
+
+namespace
+{
+	constexpr size_t MB = 1024 * 1024;
+	constexpr size_t GrowthStep = 64 * 1024;
+
+	/**
+	 * @brief
+	 *  Grows a buffer with <i>alignment</i> to <i>size</i> bytes in GrowthStep
+	 *  increments, writing to each new step.
+	 */
+	void growBuffer(size_t size, size_t alignment)
+	{
+		Buffer buffer(GrowthStep, alignment);
+
+		for (size_t current = GrowthStep; current < size; current += GrowthStep)
+		{
+			buffer.resize(current + GrowthStep);
+			memset(static_cast<std::byte*>(buffer.data()) + current, 1, GrowthStep);
+		}
+
+		keep(buffer.data());
+	}
+}
+
+void benchStreams()
+{
+	section("Buffer Growth");
+
+	std::string step_label = " in " + std::to_string(GrowthStep / 1024) + " KiB steps";
+
+	measure("Buffer::resize() to 32 MB, 8 KiB alignment (copied)" + step_label, 1, [&]()
+		{
+			growBuffer(32 * MB, 8192);
+		}
+	);
+
+	measure("Buffer::resize() to 32 MB, 64 byte alignment (remapped)" + step_label, 1, [&]()
+		{
+			growBuffer(32 * MB, 64);
+		}
+	);
+
+	measure("Buffer::resize() to 1 GB, 64 byte alignment (remapped)" + step_label, 1, [&]()
+		{
+			growBuffer(1024 * MB, 64);
+		}
+	);
+
+	std::vector<std::byte> chunk(GrowthStep, std::byte(1));
+
+	measure("BufferedStream::writeRaw() to 1 GB" + step_label, 1, [&]()
+		{
+			BufferedStream stream;
+
+			for (size_t written = 0; written < 1024 * MB; written += chunk.size())
+				stream.writeRaw(chunk.data(), chunk.size());
+
+			keep(stream.getSeekPosition());
+		}
+	);
+
+	section("Small Records");
+
+	{
+		constexpr size_t TotalSize = 100 * MB;
+
+		struct Record
+		{
+			uint64_t id;
+			uint32_t type;
+			uint32_t length;
+		};
+
+		Record record{ 1, 2, 3 };
+		std::string size_label = " to " + std::to_string(TotalSize / MB) + " MB";
+
+		measure("BufferedStream::writeRaw() of 16 byte records" + size_label, 3, [&]()
+			{
+				BufferedStream stream;
+
+				for (size_t written = 0; written < TotalSize; written += sizeof(Record))
+					stream.writeRaw(&record, sizeof(Record));
+
+				keep(stream.getSeekPosition());
+			}
+		);
+
+		measure("BufferedStream::writeRaw() of 16 byte records after reserve()" + size_label, 3, [&]()
+			{
+				BufferedStream stream;
+				stream.reserve(TotalSize);
+
+				for (size_t written = 0; written < TotalSize; written += sizeof(Record))
+					stream.writeRaw(&record, sizeof(Record));
+
+				keep(stream.getSeekPosition());
+			}
+		);
+
+		measure("BufferedStream::writeSpan() of 16 byte records" + size_label, 3, [&]()
+			{
+				BufferedStream stream;
+
+				for (size_t written = 0; written < TotalSize; written += sizeof(Record))
+				{
+					std::span<std::byte> out = stream.writeSpan(sizeof(Record));
+					memcpy(out.data(), &record, sizeof(Record));
+				}
+
+				keep(stream.release().data());
+			}
+		);
+	}
+
+	section("Vectored Writes");
+
+	{
+		struct RecordHeader
+		{
+			uint32_t type;
+			uint32_t length;
+		};
+
+		constexpr size_t RecordCount = 100000;
+
+		RecordHeader header{ 1, 120 };
+		std::array<std::byte, 120> payload{};
+
+		std::array<ConstBuffer, 2> record = {
+			ConstBuffer{ &header, sizeof(header) },
+			ConstBuffer{ payload.data(), payload.size() }
+		};
+
+		auto vec_path = std::filesystem::temp_directory_path() / "StdExt_Vectored_Bench.bin";
+		String path(vec_path.u8string());
+
+		std::string count_label = " - " + std::to_string(RecordCount / 1000) + "k records";
+
+		measure("BufferedStream header and payload with writeRaw()" + count_label, 10, [&]()
+			{
+				BufferedStream stream;
+
+				for (size_t i = 0; i < RecordCount; ++i)
+				{
+					stream.writeRaw(&header, sizeof(header));
+					stream.writeRaw(payload.data(), payload.size());
+				}
+
+				keep(stream.getSeekPosition());
+			}
+		);
+
+		measure("BufferedStream header and payload with writeVec()" + count_label, 10, [&]()
+			{
+				BufferedStream stream;
+
+				for (size_t i = 0; i < RecordCount; ++i)
+					stream.writeVec(record);
+
+				keep(stream.getSeekPosition());
+			}
+		);
+
+		measure("FdFileStream header and payload with writeRaw()" + count_label, 3, [&]()
+			{
+				std::filesystem::remove(vec_path);
+				FdFileStream stream(path, false);
+
+				for (size_t i = 0; i < RecordCount; ++i)
+				{
+					stream.writeRaw(&header, sizeof(header));
+					stream.writeRaw(payload.data(), payload.size());
+				}
+			}
+		);
+
+		measure("FdFileStream header and payload with writeVec()" + count_label, 3, [&]()
+			{
+				std::filesystem::remove(vec_path);
+				FdFileStream stream(path, false);
+
+				for (size_t i = 0; i < RecordCount; ++i)
+					stream.writeVec(record);
+			}
+		);
+
+		std::filesystem::remove(vec_path);
+	}
+
+	section("File Streams");
+
+	{
+		constexpr size_t FileSize = 64 * MB;
+
+		auto file_path = std::filesystem::temp_directory_path() / "StdExt_Stream_Bench.bin";
+		String path(file_path.u8string());
+
+		std::vector<std::byte> chunk(GrowthStep, std::byte(1));
+
+		{
+			MappedFileStream stream(path, false);
+			stream.reserve(FileSize);
+
+			for (size_t written = 0; written < FileSize; written += chunk.size())
+				stream.writeRaw(chunk.data(), chunk.size());
+		}
+
+		std::string size_label = " - " + std::to_string(FileSize / MB) + " MB";
+
+		measure("FileStream::readRaw() in 64 KiB steps" + size_label, 10, [&]()
+			{
+				FileStream stream(path, true);
+
+				for (size_t read = 0; read < FileSize; read += chunk.size())
+					stream.readRaw(chunk.data(), chunk.size());
+
+				keep(chunk.data());
+			}
+		);
+
+		measure("MappedFileStream::readRaw() in 64 KiB steps" + size_label, 10, [&]()
+			{
+				MappedFileStream stream(path, true);
+				stream.adviseAccess(MappedFileStream::AccessHint::Sequential);
+
+				for (size_t read = 0; read < FileSize; read += chunk.size())
+					stream.readRaw(chunk.data(), chunk.size());
+
+				keep(chunk.data());
+			}
+		);
+
+		measure("MappedFileStream::dataPtr() summing in place" + size_label, 10, [&]()
+			{
+				MappedFileStream stream(path, true);
+				stream.adviseAccess(MappedFileStream::AccessHint::Sequential);
+
+				const uint64_t* words = static_cast<const uint64_t*>(stream.dataPtr(0));
+				size_t word_count = stream.size() / sizeof(uint64_t);
+				uint64_t sum = 0;
+
+				for (size_t i = 0; i < word_count; ++i)
+					sum += words[i];
+
+				keep(sum);
+			}
+		);
+
+		measure("FdFileStream::readRaw() in 64 KiB steps" + size_label, 10, [&]()
+			{
+				FdFileStream stream(path, true);
+
+				for (size_t read = 0; read < FileSize; read += chunk.size())
+					stream.readRaw(chunk.data(), chunk.size());
+
+				keep(chunk.data());
+			}
+		);
+
+		measure("FdFileStream::readAt() from 4 threads in 64 KiB steps" + size_label, 10, [&]()
+			{
+				constexpr size_t ThreadCount = 4;
+				constexpr size_t Region = FileSize / ThreadCount;
+
+				FdFileStream stream(path, true);
+				std::vector<std::thread> readers;
+
+				for (size_t t = 0; t < ThreadCount; ++t)
+				{
+					readers.emplace_back(
+						[&, t]()
+						{
+							std::vector<std::byte> local(GrowthStep);
+
+							for (size_t offset = t * Region; offset < (t + 1) * Region; offset += local.size())
+								stream.readAt(offset, local.data(), local.size());
+
+							keep(local.data());
+						}
+					);
+				}
+
+				for (auto& reader : readers)
+					reader.join();
+			}
+		);
+
+		section("Asynchronous File I/O");
+
+		SharedData<> destination(FileSize, FdFileStream::DirectAlignment);
+
+		auto readAll = [&](AsyncFileIO& io, FdFileStream& file)
+			{
+				AsyncFileIO::Batch batch(io);
+
+				for (size_t offset = 0; offset < FileSize; offset += chunk.size())
+					batch.read(file, offset, SharedDataView<>(destination, offset, chunk.size()), [](size_t, std::exception_ptr) {});
+
+				batch.submit();
+				io.drain();
+
+				keep(destination.data());
+			};
+
+		std::vector<AsyncFileIO::Backend> backends = { AsyncFileIO::Backend::ThreadPool };
+
+		if ( AsyncFileIO::ioUringAvailable() )
+			backends.push_back(AsyncFileIO::Backend::IoUring);
+
+		for (AsyncFileIO::Backend backend : backends)
+		{
+			std::string backend_name = (AsyncFileIO::Backend::IoUring == backend) ? "io_uring" : "thread pool";
+
+			for (size_t depth : { 1, 4, 16, 64 })
+			{
+				AsyncFileIO io(depth, backend);
+				std::string label = " on " + backend_name + " at depth " + std::to_string(depth) + size_label;
+
+				measure("AsyncFileIO reads in 64 KiB requests" + label, 10, [&]()
+					{
+						FdFileStream file(path, true);
+						readAll(io, file);
+					}
+				);
+
+				std::optional<FdFileStream> direct_file;
+
+				try
+				{
+					direct_file.emplace(path, true, FdFileStream::DIRECT_IO);
+				}
+				catch (const std::runtime_error&)
+				{
+					// Some file systems, such as tmpfs, do not support direct I/O.
+					continue;
+				}
+
+				measure("AsyncFileIO direct reads in 64 KiB requests" + label, 10, [&]()
+					{
+						readAll(io, *direct_file);
+					}
+				);
+			}
+		}
+
+		std::filesystem::remove(file_path);
+	}
+}
@@ -0,0 +1,511 @@
+#include "Bench.h"
+
+#include <StdExt/String.h>
+#include <StdExt/StringBuilder.h>
+#include <StdExt/InternedString.h>
+#include <StdExt/Format.h>
+#include <StdExt/Vec.h>
+
+#include <algorithm>
+#include <cctype>
+#include <format>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace StdExt;
+using namespace StdExt::Bench;
+
+template<size_t small_byte_size>
+static void benchSmallSize(const std::vector<std::u8string>& keys)
+{
+	using string_t = StringBase<char8_t, small_byte_size>;
+
+	std::string label = std::to_string(small_byte_size) + " byte small size";
+	std::vector<string_t> strings;
+	strings.reserve(keys.size());
+
+	measure("Construct " + std::to_string(keys.size()) + " keys - " + label, 1, [&]()
+		{
+			for (const auto& key : keys)
+				strings.emplace_back(std::u8string_view(key));
+		}
+	);
+
+	size_t heap_count = 0;
+
+	for (const auto& str : strings)
+		heap_count += str.isOnHeap() ? 1 : 0;
+
+	std::cout << "  heap allocations: " << heap_count << " of " << strings.size() <<
+		", object size: " << sizeof(string_t) << " bytes" << std::endl;
+
+	measure("Copy " + std::to_string(keys.size()) + " keys - " + label, 10, [&]()
+		{
+			std::vector<string_t> copies(strings);
+			keep(copies.size());
+		}
+	);
+
+	measure("Compare " + std::to_string(keys.size()) + " keys - " + label, 10, [&]()
+		{
+			size_t matches = 0;
+
+			for (size_t i = 1; i < strings.size(); ++i)
+				matches += (strings[i] == strings[i - 1]) ? 1 : 0;
+
+			keep(matches);
+		}
+	);
+}
+
+void benchString()
+{
+	section("String Concatenation");
+
+	U8String piece(u8"<element attribute=\"value\">text</element>");
+
+	for (size_t target_size : { 16 * 1024, 256 * 1024, 1024 * 1024 })
+	{
+		size_t append_count = target_size / piece.size();
+		std::string size_label = std::to_string(target_size / 1024) + " KB";
+
+		measure("StringBase::operator+= - " + size_label, 1, [&]()
+			{
+				U8String result;
+
+				for (size_t i = 0; i < append_count; ++i)
+					result += piece;
+
+				keep(result.size());
+			}
+		);
+
+		measure("StringBuilder::append() - " + size_label, 1, [&]()
+			{
+				U8StringBuilder builder;
+
+				for (size_t i = 0; i < append_count; ++i)
+					builder.append(piece);
+
+				U8String result = builder.toString();
+				keep(result.size());
+			}
+		);
+
+		measure("std::u8string::operator+= - " + size_label, 1, [&]()
+			{
+				std::u8string result;
+
+				for (size_t i = 0; i < append_count; ++i)
+					result += piece.view();
+
+				keep(result.size());
+			}
+		);
+	}
+
+	section("String Conversion");
+
+	std::vector<U8String> short_strings;
+	for (size_t i = 0; i < 1000; ++i)
+		short_strings.emplace_back(u8"key_" + std::u8string(1, u8'a' + (i % 26)) + u8"_value");
+
+	measure("convertString<char16_t>() - 1000 short UTF-8 strings", 1000, [&]()
+		{
+			for (const auto& str : short_strings)
+				keep(convertString<char16_t>(str).size());
+		}
+	);
+
+	U8StringBuilder long_builder;
+	for (size_t i = 0; i < 4096; ++i)
+		long_builder.append(u8"ASCII payload text with an occasional \u00E9 accent. ");
+
+	U8String long_string = long_builder.toString();
+	U16String long_u16 = convertString<char16_t>(long_string);
+
+	measure("convertString<char16_t>() - 200 KB UTF-8 string", 100, [&]()
+		{
+			keep(convertString<char16_t>(long_string).size());
+		}
+	);
+
+	measure("convertString<char8_t>() - 200 KB UTF-16 string", 100, [&]()
+		{
+			keep(convertString<char8_t>(long_u16).size());
+		}
+	);
+
+	measure("convertString<char32_t>() - 200 KB UTF-8 string", 100, [&]()
+		{
+			keep(convertString<char32_t>(long_string).size());
+		}
+	);
+
+	section("String Search");
+
+	U8String haystack = long_string + U8String::literal(u8"needle in the haystack|");
+	std::u8string_view haystack_view = haystack.view();
+
+	measure("StringBase::find(char) - 200 KB", 1000, [&]()
+		{
+			keep(haystack.find(u8'|'));
+		}
+	);
+
+	measure("std::u8string_view::find(char) - 200 KB", 1000, [&]()
+		{
+			keep(haystack_view.find(u8'|'));
+		}
+	);
+
+	measure("StringBase::find(substring) - 200 KB", 1000, [&]()
+		{
+			keep(haystack.find(u8"needle in"));
+		}
+	);
+
+	measure("std::u8string_view::find(substring) - 200 KB", 1000, [&]()
+		{
+			keep(haystack_view.find(u8"needle in"));
+		}
+	);
+
+	measure("StringBase::findFirstOf(3 characters) - 200 KB", 1000, [&]()
+		{
+			keep(haystack.findFirstOf(u8"|#@"));
+		}
+	);
+
+	measure("std::u8string_view::find_first_of(3 characters) - 200 KB", 1000, [&]()
+		{
+			keep(haystack_view.find_first_of(u8"|#@"));
+		}
+	);
+
+	measure("StringBase::findFirstOf(12 characters) - 200 KB", 1000, [&]()
+		{
+			keep(haystack.findFirstOf(u8"|#@$%^&*~{}["));
+		}
+	);
+
+	measure("std::u8string_view::find_first_of(12 characters) - 200 KB", 1000, [&]()
+		{
+			keep(haystack_view.find_first_of(u8"|#@$%^&*~{}["));
+		}
+	);
+
+	measure("StringBase::split() - 200 KB", 100, [&]()
+		{
+			keep(haystack.split(u8". ").size());
+		}
+	);
+
+	measure("StringBase::splitView() - 200 KB", 100, [&]()
+		{
+			size_t count = 0;
+
+			for (const auto& item : haystack.splitView(u8". "))
+				count += item.size();
+
+			keep(count);
+		}
+	);
+
+	measure("std::u8string_view::find() split loop - 200 KB", 100, [&]()
+		{
+			size_t count = 0;
+			size_t begin = 0;
+			size_t end = 0;
+
+			while ( (end = haystack_view.find(u8". ", begin)) != std::u8string_view::npos )
+			{
+				count += end - begin;
+				begin = end + 2;
+			}
+
+			keep(count);
+		}
+	);
+
+	section("String Interning");
+
+	std::vector<U8String> keys;
+	std::vector<U8InternedString> interned_keys;
+
+	for (size_t i = 0; i < 4096; ++i)
+	{
+		keys.push_back(
+			U8String(u8"routing.signal.") + U8String(std::u8string(1, u8'a' + (i % 26))) +
+			U8String(u8".channel.") + U8String(std::u8string(1, u8'a' + (i / 26) % 26)) +
+			U8String(u8".") + U8String(std::u8string(1, u8'a' + (i / 676) % 26))
+		);
+	}
+
+	measure("StringPool::intern() - 4096 new keys", 1, [&]()
+		{
+			for (const auto& key : keys)
+				interned_keys.push_back(U8InternedString(key));
+		}
+	);
+
+	U8String target = keys[keys.size() - 1];
+	U8InternedString interned_target(target);
+
+	measure("StringBase::operator== - 4096 keys", 1000, [&]()
+		{
+			size_t matches = 0;
+
+			for (const auto& key : keys)
+				matches += (key == target) ? 1 : 0;
+
+			keep(matches);
+		}
+	);
+
+	measure("InternedString::operator== - 4096 keys", 1000, [&]()
+		{
+			size_t matches = 0;
+
+			for (const auto& key : interned_keys)
+				matches += (key == interned_target) ? 1 : 0;
+
+			keep(matches);
+		}
+	);
+
+	std::unordered_map<std::u8string, size_t> std_map;
+	std::unordered_map<U8InternedString, size_t> interned_map;
+
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		std_map[keys[i].toStdString()] = i;
+		interned_map[interned_keys[i]] = i;
+	}
+
+	measure("std::unordered_map<std::u8string> lookup - 4096 keys", 100, [&]()
+		{
+			size_t sum = 0;
+
+			for (const auto& key : keys)
+				sum += std_map.find(key.toStdString())->second;
+
+			keep(sum);
+		}
+	);
+
+	measure("std::unordered_map<InternedString> lookup - 4096 keys", 100, [&]()
+		{
+			size_t sum = 0;
+
+			for (const auto& key : interned_keys)
+				sum += interned_map.find(key)->second;
+
+			keep(sum);
+		}
+	);
+
+	section("String Hashing");
+
+	U8String short_key = U8String::literal(u8"routing.signal.a");
+
+	measure("StringBase::hash() - 16 bytes", 1000000, [&]()
+		{
+			keep(short_key.hash());
+		}
+	);
+
+	measure("std::hash<std::u8string_view> - 16 bytes", 1000000, [&]()
+		{
+			keep(std::hash<std::u8string_view>{}(short_key.view()));
+		}
+	);
+
+	measure("StringBase::hash() - 200 KB", 1000, [&]()
+		{
+			keep(haystack.hash());
+		}
+	);
+
+	measure("std::hash<std::u8string_view> - 200 KB", 1000, [&]()
+		{
+			keep(std::hash<std::u8string_view>{}(haystack_view));
+		}
+	);
+
+	std::unordered_map<U8String, size_t, std::hash<U8String>, std::equal_to<>> string_map;
+
+	for (size_t i = 0; i < keys.size(); ++i)
+		string_map[keys[i]] = i;
+
+	measure("std::unordered_map<StringBase> lookup - 4096 keys", 100, [&]()
+		{
+			size_t sum = 0;
+
+			for (const auto& key : keys)
+				sum += string_map.find(key)->second;
+
+			keep(sum);
+		}
+	);
+
+	measure("std::unordered_map<StringBase> view lookup - 4096 keys", 100, [&]()
+		{
+			size_t sum = 0;
+
+			for (const auto& key : keys)
+				sum += string_map.find(key.view())->second;
+
+			keep(sum);
+		}
+	);
+
+	section("String Small Size");
+
+	std::mt19937 random(42);
+	std::normal_distribution<double> key_length(28.0, 8.0);
+	std::vector<std::u8string> size_keys;
+
+	for (size_t i = 0; i < 100000; ++i)
+	{
+		size_t length = static_cast<size_t>(std::clamp(key_length(random), 4.0, 64.0));
+		std::u8string key;
+
+		while (key.size() < length)
+			key += static_cast<char8_t>(u8'a' + random() % 26);
+
+		size_keys.push_back(std::move(key));
+	}
+
+	benchSmallSize<16>(size_keys);
+	benchSmallSize<32>(size_keys);
+	benchSmallSize<64>(size_keys);
+
+	section("String Case and Trimming");
+
+	std::u8string header_text;
+
+	while (header_text.size() < 1024)
+		header_text += u8"Content-Type: Application/JSON; Charset=UTF-8; ";
+
+	U8String header = U8String(std::u8string_view(header_text));
+	U8String header_upper = header.toUpper();
+
+	measure("StringBase::toLower() - 1 KB", 100000, [&]()
+		{
+			keep(header.toLower());
+		}
+	);
+
+	measure("StringBase::toLower() && - 1 KB, uniquely owned", 100000, [&]()
+		{
+			U8String copy(header.view());
+			keep(std::move(copy).toLower());
+		}
+	);
+
+	measure("std::transform(::tolower) on std::u8string - 1 KB", 100000, [&]()
+		{
+			std::u8string copy(header.view());
+			std::transform(copy.begin(), copy.end(), copy.begin(),
+				[](char8_t ch) { return static_cast<char8_t>(std::tolower(ch)); }
+			);
+
+			keep(copy);
+		}
+	);
+
+	measure("StringBase::caseInsensitiveCompare() - 1 KB", 100000, [&]()
+		{
+			keep(header.caseInsensitiveEquals(header_upper));
+		}
+	);
+
+	measure("std::tolower() comparison loop - 1 KB", 100000, [&]()
+		{
+			auto left = header.view();
+			auto right = header_upper.view();
+
+			keep(
+				std::equal(left.begin(), left.end(), right.begin(), right.end(),
+					[](char8_t l, char8_t r) { return std::tolower(l) == std::tolower(r); }
+				)
+			);
+		}
+	);
+
+	U8String padded = U8String::literal(u8"   \t  request-id: 0b8f2c7e-31d4-4a8e-9c55-2f1d6e8a7b90  \r\n");
+
+	measure("StringBase::trim()", 1000000, [&]()
+		{
+			keep(padded.trim());
+		}
+	);
+
+	measure("std::u8string find_first_not_of() / substr()", 1000000, [&]()
+		{
+			std::u8string_view view = padded.view();
+			std::u8string_view whitespace = u8" \t\r\n\f\v";
+
+			size_t start = view.find_first_not_of(whitespace);
+			size_t end = view.find_last_not_of(whitespace);
+
+			keep(std::u8string(view.substr(start, end - start + 1)));
+		}
+	);
+
+	section("String Formatting");
+
+	std::string name("reactor_core");
+	U8String u8_name = U8String::literal(u8"reactor_core");
+
+	measure("StdExt::format - int, 2 doubles, string", 1000000, [&]()
+		{
+			keep(StdExt::format(u8"id={} x={} y={} name={}", 4217, 12.5, -0.125, u8_name));
+		}
+	);
+
+	measure("std::format - int, 2 doubles, string", 1000000, [&]()
+		{
+			keep(std::format("id={} x={} y={} name={}", 4217, 12.5, -0.125, name));
+		}
+	);
+
+	measure("std::ostringstream - int, 2 doubles, string", 1000000, [&]()
+		{
+			std::ostringstream stream;
+			stream << "id=" << 4217 << " x=" << 12.5 << " y=" << -0.125 << " name=" << name;
+
+			keep(stream.str());
+		}
+	);
+
+	measure("StdExt::format - short result", 1000000, [&]()
+		{
+			keep(StdExt::format(u8"{}:{}", 80, 443));
+		}
+	);
+
+	measure("std::format - short result", 1000000, [&]()
+		{
+			keep(std::format("{}:{}", 80, 443));
+		}
+	);
+
+	Vec3<float32_t> position(1.5f, -2.25f, 1024.0f);
+
+	measure("StdExt::format - Vec3<float32_t>", 1000000, [&]()
+		{
+			keep(StdExt::format(u8"position: {}", position));
+		}
+	);
+
+	measure("Number::toString() - float64_t", 1000000, [&]()
+		{
+			keep(Number(3.14159).toString());
+		}
+	);
+}
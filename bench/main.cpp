@@ -0,0 +1,14 @@
+extern void benchMemory();
+extern void benchNumber();
+extern void benchStreams();
+extern void benchString();
+
+int main()
+{
+	benchString();
+	benchNumber();
+	benchMemory();
+	benchStreams();
+
+	return 0;
+}
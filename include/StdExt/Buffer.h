@@ -56,6 +56,10 @@ namespace StdExt
 		 *  Resizes the buffer retaining existing data.  If the buffer is smaller than
 		 *  the current size, data will be truncated.  If alignment is 0, the current
 		 *  alignment will be used.
+		 *
+		 *  On Linux, buffers of a megabyte or more with an alignment of up to a page are
+		 *  mapped directly from the system, and are grown by remapping their pages instead
+		 *  of copying their contents.
 		 */
 		void resize(size_t size, size_t alignment = 0);
 
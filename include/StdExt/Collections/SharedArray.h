@@ -5,10 +5,17 @@
 #include "../Type.h"
 
 #include "../Memory/Alignment.h"
+#include "../Memory/Allocator.h"
 #include "../Memory/Casting.h"
+#include "../Memory/RefCount.h"
 
+#include <algorithm>
 #include <cassert>
 #include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
 
 #if defined(STD_EXT_DEBUG)
 #	include <span>
@@ -16,7 +23,17 @@
 
 namespace StdExt::Collections
 {
-	template<typename T>
+	/**
+	 * @brief
+	 *  A reference counted array whose elements are stored in the same allocation as
+	 *  the reference count, or adopted from another owning object.  That allocation can
+	 *  be made from an Allocator, which is then used for all reallocations of the array.
+	 *
+	 * @tparam ref_count_t
+	 *  The reference counting policy.  LocalRefCount can be used for arrays that are
+	 *  only referenced from a single thread.
+	 */
+	template<typename T, ReferenceCounter ref_count_t = AtomicRefCount>
 	class SharedArray final
 	{
 	#if defined(STD_EXT_DEBUG)
@@ -42,8 +59,37 @@ namespace StdExt::Collections
 			block_view_t view;
 		#endif
 
-			std::atomic<int> refCount = 1;
+			ref_count_t refCount;
 			size_t size = 0;
+			T* data = nullptr;
+
+			/**
+			 * @internal
+			 * @brief
+			 *  The number of elements that can be stored at allocStart.  This is the size
+			 *  of adopted blocks, which cannot grow in place.
+			 */
+			size_t capacity = 0;
+
+			/**
+			 * @internal
+			 * @brief
+			 *  Releases the block and its elements when they are adopted from an owning
+			 *  object.  Null for blocks that store their elements at allocStart.
+			 */
+			void (*release)(ControlBlock*) = nullptr;
+
+			/**
+			 * @internal
+			 * @brief
+			 *  The allocator of the block, or null if it is from alloc_aligned().
+			 */
+			Allocator* allocator = nullptr;
+
+		#if defined(STD_EXT_CACHE_STRING_HASH)
+			std::atomic<uint64_t> hash = 0;
+		#endif
+
 			alignas(T) char allocStart = 0;
 		};
 
@@ -52,17 +98,147 @@ namespace StdExt::Collections
 		static ControlBlock* incrementBlock(ControlBlock* block)
 		{
 			if (block)
-				++block->refCount;
+				block->refCount.increment();
 
 			return block;
 		}
 
+		static constexpr size_t blockSize(size_t capacity)
+		{
+			return offsetof(ControlBlock, allocStart) + sizeof(T) * capacity;
+		}
+
+		static ControlBlock* allocateBlock(size_t capacity, Allocator* allocator)
+		{
+			auto allocation = (allocator) ?
+				allocator->allocate(blockSize(capacity), alignof(ControlBlock)) :
+				alloc_aligned(blockSize(capacity), alignof(ControlBlock));
+
+			ControlBlock* block = new (allocation)ControlBlock;
+			block->capacity = capacity;
+			block->data = access_as<T*>(&block->allocStart);
+			block->allocator = allocator;
+
+			return block;
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Frees a block from allocateBlock() after its elements have been destroyed.
+		 */
+		static void freeBlock(ControlBlock* block)
+		{
+			Allocator* allocator = block->allocator;
+			size_t size = blockSize(block->capacity);
+
+			block->~ControlBlock();
+
+			if (allocator)
+				allocator->deallocate(block, size, alignof(ControlBlock));
+			else
+				free_aligned(block);
+		}
+
+		static void setSize(ControlBlock* block, size_t size)
+		{
+			block->size = size;
+
+			#if defined(STD_EXT_DEBUG)
+				block->view = block_view_t(block->data, block->size);
+			#endif
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  True if this is the only reference to the block and the elements are stored in
+		 *  the block itself, so they can be destroyed, added, or moved by this object.
+		 */
+		bool ownsStorage() const noexcept
+		{
+			return (isUnique() && nullptr == mControlBlock->release);
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Makes this the only reference to a block with room for <i>capacity</i>
+		 *  elements, keeping up to that many of the existing elements.
+		 *
+		 * @details
+		 *  A block this object owns is resized with realloc_aligned() when the elements
+		 *  can be moved by a memory copy and the block is not from an Allocator.  Otherwise
+		 *  the elements are moved to a new block if this object owns them, or copied if
+		 *  they are shared or adopted.  New blocks come from the allocator of the current
+		 *  block.
+		 */
+		void reallocate(size_t capacity)
+		{
+			size_t keep = std::min(size(), capacity);
+
+			if constexpr ( MemMovable<T> )
+			{
+				if ( ownsStorage() && nullptr == mControlBlock->allocator )
+				{
+					destroy_n(span().subspan(keep));
+
+					mControlBlock = static_cast<ControlBlock*>(
+						realloc_aligned(mControlBlock, blockSize(capacity), alignof(ControlBlock))
+					);
+
+					mControlBlock->capacity = capacity;
+					mControlBlock->data = access_as<T*>(&mControlBlock->allocStart);
+					setSize(mControlBlock, keep);
+
+					return;
+				}
+			}
+
+			ControlBlock* block = allocateBlock(
+				capacity, (mControlBlock) ? mControlBlock->allocator : nullptr
+			);
+
+			if ( ownsStorage() )
+			{
+				move_n(mControlBlock->data, block->data, keep);
+				destroy_n(span().subspan(keep));
+
+				// The moved elements have already been destroyed.
+				mControlBlock->size = 0;
+			}
+			else if ( keep > 0 )
+			{
+				try
+				{
+					copy_n<T>(mControlBlock->data, block->data, keep);
+				}
+				catch (...)
+				{
+					freeBlock(block);
+					throw;
+				}
+			}
+
+			setSize(block, keep);
+
+			decrementBlock();
+			mControlBlock = block;
+		}
+
 		void decrementBlock()
 		{
-			if (nullptr != mControlBlock && 0 == --mControlBlock->refCount)
+			if (nullptr != mControlBlock && mControlBlock->refCount.decrement())
 			{
-				destroy_n(span());
-				free_aligned(mControlBlock);
+				if (mControlBlock->release)
+				{
+					mControlBlock->release(mControlBlock);
+				}
+				else
+				{
+					destroy_n(span());
+					freeBlock(mControlBlock);
+				}
 			}
 
 			mControlBlock = nullptr;
@@ -77,21 +253,31 @@ namespace StdExt::Collections
 		{
 			if (count > 0)
 			{
-				constexpr auto offset = offsetof(ControlBlock, allocStart);
+				mControlBlock = allocateBlock(count, nullptr);
+				setSize(mControlBlock, count);
 
-				auto allocation = alloc_aligned(
-					offset + sizeof(T) * count, alignof(ControlBlock)
+				fill_uninitialized_n(
+					span(),
+					std::forward<args_t>(arguments)...
 				);
+			}
+		}
 
-				mControlBlock = new (allocation)ControlBlock;
-				mControlBlock->size = count;
-
-				#if defined(STD_EXT_DEBUG)
-					mControlBlock->view = block_view_t(
-						access_as<T*>(&mControlBlock->allocStart),
-						mControlBlock->size
-					);
-				#endif
+		/**
+		 * @brief
+		 *  Creates an array of <i>count</i> elements in memory from <i>allocator</i>.  Later
+		 *  reallocations of the array, and of copies made unique, also use <i>allocator</i>.
+		 */
+		template<typename ...args_t>
+		SharedArray(Allocator& allocator, size_t count, args_t ...arguments)
+			: SharedArray()
+		{
+			if (count > 0)
+			{
+				mControlBlock = allocateBlock(
+					count, (&allocator == &Allocator::heap()) ? nullptr : &allocator
+				);
+				setSize(mControlBlock, count);
 
 				fill_uninitialized_n(
 					span(),
@@ -100,6 +286,86 @@ namespace StdExt::Collections
 			}
 		}
 
+		/**
+		 * @brief
+		 *  Creates an array of elements owned by another object without copying them.
+		 *
+		 * @details
+		 *  <i>owner</i> is moved into a newly allocated control block, and
+		 *  <i>get_elements</i> is then called with the stored owner to get a std::span<T>
+		 *  of the elements.  Getting the elements after the move keeps this correct for
+		 *  owners that store small contents inside themselves.  The elements are released
+		 *  by the destructor of the owner when the last reference to the array is released.
+		 */
+		template<typename owner_t, typename get_elements_t>
+		static SharedArray adopt(owner_t&& owner, get_elements_t&& get_elements)
+		{
+			using stored_t = std::remove_cvref_t<owner_t>;
+
+			struct AdoptedBlock : public ControlBlock
+			{
+				stored_t owner;
+
+				AdoptedBlock(owner_t&& in_owner)
+					: owner(std::forward<owner_t>(in_owner))
+				{
+				}
+			};
+
+			void* allocation = alloc_aligned(sizeof(AdoptedBlock), alignof(AdoptedBlock));
+			AdoptedBlock* block = nullptr;
+
+			try
+			{
+				block = new (allocation) AdoptedBlock(std::forward<owner_t>(owner));
+			}
+			catch (...)
+			{
+				free_aligned(allocation);
+				throw;
+			}
+
+			std::span<T> elements = get_elements(block->owner);
+
+			block->data = elements.data();
+			block->size = elements.size();
+			block->capacity = elements.size();
+			block->release = [](ControlBlock* control)
+			{
+				AdoptedBlock* adopted = static_cast<AdoptedBlock*>(control);
+
+				adopted->~AdoptedBlock();
+				free_aligned(adopted);
+			};
+
+			#if defined(STD_EXT_DEBUG)
+				block->view = block_view_t(block->data, block->size);
+			#endif
+
+			SharedArray ret;
+			ret.mControlBlock = block;
+
+			return ret;
+		}
+
+		/**
+		 * @brief
+		 *  Creates an array of <i>count</i> elements at <i>data</i> without copying them.
+		 *  <i>deleter</i> is called with <i>data</i> when the last reference to the array is
+		 *  released.
+		 */
+		template<typename deleter_t>
+		static SharedArray adopt(T* data, size_t count, deleter_t deleter)
+		{
+			return adopt(
+				std::unique_ptr<T[], deleter_t>(data, std::move(deleter)),
+				[count](std::unique_ptr<T[], deleter_t>& owner)
+				{
+					return std::span<T>(owner.get(), count);
+				}
+			);
+		}
+
 		SharedArray(const SharedArray& other)
 		{
 			mControlBlock = incrementBlock(other.mControlBlock);
@@ -140,42 +406,36 @@ namespace StdExt::Collections
 		std::span<T> span()
 		{
 			return (mControlBlock) ?
-				std::span<T>(
-					access_as<T*>(&mControlBlock->allocStart),
-					mControlBlock->size
-				) :
+				std::span<T>(mControlBlock->data, mControlBlock->size) :
 				std::span<T>();
 		}
 
 		T* data()
 		{
-			return access_as<T*>(&mControlBlock->allocStart);
+			return (mControlBlock) ? mControlBlock->data : nullptr;
 		}
 
 		const T* data() const
 		{
-			return access_as<const T*>(&mControlBlock->allocStart);
+			return (mControlBlock) ? mControlBlock->data : nullptr;
 		}
 
 		std::span<const T> span() const
 		{
 			return (mControlBlock) ?
-				std::span<const T>(
-					access_as<const T*>(&mControlBlock->allocStart),
-					mControlBlock->size
-				) :
+				std::span<const T>(mControlBlock->data, mControlBlock->size) :
 				std::span<const T>();
 		}
 
 		T& operator[](size_t index)
 		{
 			assert(mControlBlock && mControlBlock->size > 0);
-			return access_as<T*>(&mControlBlock->allocStart)[index];
+			return mControlBlock->data[index];
 		}
 
 		const T& operator[](size_t index) const
 		{
-			return access_as<const T*>(&mControlBlock->allocStart)[index];
+			return mControlBlock->data[index];
 		}
 
 		bool operator==(const SharedArray& other) const
@@ -202,6 +462,133 @@ namespace StdExt::Collections
 		{
 			return (nullptr == mControlBlock);
 		}
+
+		/**
+		 * @brief
+		 *  Returns true if this is the only reference to the array, in which case its
+		 *  contents can be modified without affecting other objects.
+		 */
+		bool isUnique() const noexcept
+		{
+			return (nullptr != mControlBlock && 1 == mControlBlock->refCount.count());
+		}
+
+		/**
+		 * @brief
+		 *  The allocator of the memory of the array.  This is Allocator::heap() for null
+		 *  arrays and arrays that adopted their elements.
+		 */
+		Allocator& allocator() const noexcept
+		{
+			return (mControlBlock && mControlBlock->allocator) ?
+				*mControlBlock->allocator : Allocator::heap();
+		}
+
+		/**
+		 * @brief
+		 *  The number of elements the array can hold before resize() needs a new
+		 *  allocation.  This is the size of arrays that adopted their elements.
+		 */
+		size_t capacity() const
+		{
+			return (mControlBlock) ? mControlBlock->capacity : 0;
+		}
+
+		/**
+		 * @brief
+		 *  Copies the elements into memory referenced only by this object if they are
+		 *  shared with other references.  Nothing is copied if the array is already unique.
+		 */
+		void makeUnique()
+		{
+			if ( nullptr != mControlBlock && !isUnique() )
+				reallocate(mControlBlock->size);
+		}
+
+		/**
+		 * @brief
+		 *  Makes the array unique and ensures it can hold at least <i>count</i> elements
+		 *  without another allocation.
+		 *
+		 * @details
+		 *  A unique array with enough capacity is left unchanged, and one with too little
+		 *  is grown in place when possible.  Shared arrays are copied, and arrays that
+		 *  adopted their elements are copied when they need to grow.
+		 */
+		void reserve(size_t count)
+		{
+			if ( nullptr == mControlBlock && 0 == count )
+				return;
+
+			if ( count > capacity() || !isUnique() )
+				reallocate(std::max(count, size()));
+		}
+
+		/**
+		 * @brief
+		 *  Makes the array unique and sets its size to <i>count</i>, constructing new
+		 *  elements with <i>arguments</i> or destroying elements past the new end.
+		 *
+		 * @details
+		 *  The elements of a uniquely owned array are resized in place.  When more capacity
+		 *  is needed, it at least doubles, so appending to a uniquely owned array by
+		 *  repeatedly resizing is amortized constant time per element.
+		 */
+		template<typename ...args_t>
+		void resize(size_t count, args_t ...arguments)
+		{
+			if ( nullptr == mControlBlock && 0 == count )
+				return;
+
+			if ( count > capacity() )
+				reallocate(std::max(count, 2 * capacity()));
+			else if ( !ownsStorage() )
+				reallocate(count);
+
+			size_t current = mControlBlock->size;
+
+			if ( count < current )
+			{
+				destroy_n(span().subspan(count));
+			}
+			else
+			{
+				fill_uninitialized_n(
+					std::span<T>(mControlBlock->data + current, count - current),
+					std::forward<args_t>(arguments)...
+				);
+			}
+
+			setSize(mControlBlock, count);
+
+		#if defined(STD_EXT_CACHE_STRING_HASH)
+			mControlBlock->hash.store(0, std::memory_order_relaxed);
+		#endif
+		}
+
+	#if defined(STD_EXT_CACHE_STRING_HASH)
+		/**
+		 * @brief
+		 *  A hash of the contents stored by setCachedHash(), or zero if none has been
+		 *  stored.  This is shared by all references to the array.
+		 */
+		uint64_t cachedHash() const noexcept
+		{
+			return (mControlBlock) ?
+				mControlBlock->hash.load(std::memory_order_relaxed) : 0;
+		}
+
+		/**
+		 * @brief
+		 *  Stores a hash of the contents for all references to the array.  Code that
+		 *  modifies the contents after a hash has been stored must reset it to zero.
+		 */
+		void setCachedHash(uint64_t hash) const noexcept
+		{
+			if (mControlBlock)
+				mControlBlock->hash.store(hash, std::memory_order_relaxed);
+		}
+	#endif
 	};
 }
 
@@ -9,6 +9,7 @@
 
 #include "../Serialize/Binary/Binary.h"
 #include "../Serialize/XML/XML.h"
+#include "../Memory/Allocator.h"
 #include "../Memory/Utility.h"
 
 #include <exception>
@@ -27,7 +28,8 @@ namespace StdExt::Collections
 	 *  is that a user specified number of items can be stored locally within
 	 *  the container, instead of within a separate heap allocation.  It also
 	 *  allows the user to specify granularity of block allocations for resize
-	 *  operations.
+	 *  operations.  Storage that is not local can come from an Allocator passed
+	 *  to the constructor.
 	 *
 	 * @tparam T
 	 *  The type of elements.
@@ -83,6 +85,12 @@ namespace StdExt::Collections
 		 */
 		buffer_t mLocalData;
 
+		/**
+		 * @brief
+		 *  The source of storage that is not local, or null to use allocate_n().
+		 */
+		Allocator* mAllocator;
+
 		std::span<T> activeSpan() const
 		{
 			return mAllocatedSpan.subspan(0, mSize);
@@ -111,6 +119,30 @@ namespace StdExt::Collections
 			return (localSpan().data() == mAllocatedSpan.data());
 		}
 
+		T* allocateElements(size_t count)
+		{
+			if (mAllocator)
+				return static_cast<T*>(mAllocator->allocate(sizeof(T) * count, alignof(T)));
+
+			return allocate_n<T>(count);
+		}
+
+		/**
+		 * @brief
+		 *  Frees the storage of mAllocatedSpan if it is not local.  Elements must
+		 *  have already been moved or destroyed.
+		 */
+		void freeAllocatedSpan()
+		{
+			if ( nullptr == mAllocatedSpan.data() || elementsLocal() )
+				return;
+
+			if (mAllocator)
+				mAllocator->deallocate(mAllocatedSpan.data(), sizeof(T) * mAllocatedSpan.size(), alignof(T));
+			else
+				free_n(mAllocatedSpan.data());
+		}
+
 		/**
 		 * @brief
 		 *  Reallocates the memory store of the elements so that it can
@@ -144,17 +176,13 @@ namespace StdExt::Collections
 				else
 				{
 					destination = std::span<T>(
-						allocate_n<T>(next_size),
+						allocateElements(next_size),
 						next_size
 					);
 				}
 
 				move_n<T>(activeSpan(), destination);
-
-				auto local_span = localSpan();
-
-				if ( mAllocatedSpan.data() == local_span.data() && mAllocatedSpan.size() != local_span.size() )
-					free_n(mAllocatedSpan.data());
+				freeAllocatedSpan();
 
 				mAllocatedSpan = destination;
 			}
@@ -167,20 +195,24 @@ namespace StdExt::Collections
 			mSize = 0;
 
 			reallocate(other.mSize, true, false);
-			copy_n(other.activeSpan(), mAllocatedSpan, other.mSize);
+			copy_n<T>(other.mAllocatedSpan.data(), mAllocatedSpan.data(), other.mSize);
 			mSize = other.mSize;
 		}
 
+		/**
+		 * @brief
+		 *  Takes the storage of <i>other</i> when it is not local and both vectors use
+		 *  the same allocator.  Otherwise the elements are moved individually.
+		 */
 		template<size_t other_local, bool other_auto_shrink, size_t other_block>
 		void moveFrom(Vector<T, other_local, other_auto_shrink, other_block>&& other)
 		{
 			destroy_n<T>(activeSpan());
 			mSize = 0;
 
-			if (other.mSize > local_size && false == other.elementsLocal())
+			if (other.mSize > local_size && false == other.elementsLocal() && mAllocator == other.mAllocator)
 			{
-				if (false == elementsLocal())
-					free_n(mAllocatedSpan.data());
+				freeAllocatedSpan();
 
 				mAllocatedSpan = other.mAllocatedSpan;
 				mSize = other.mSize;
@@ -196,17 +228,27 @@ namespace StdExt::Collections
 				mSize = other.mSize;
 				other.mSize = 0;
 
-				if (false == other.elementsLocal())
-					free_n<T>(other.mAllocatedSpan.data());
-
+				other.freeAllocatedSpan();
 				other.mAllocatedSpan = other.localSpan();
 			}
 		}
 
 	public:
 		constexpr Vector()
-			: mSize(0)
+			: mSize(0), mAllocator(nullptr)
+		{
+		}
+
+		/**
+		 * @brief
+		 *  Creates an empty vector that gets storage that is not local from
+		 *  <i>allocator</i>.
+		 */
+		explicit Vector(Allocator& allocator)
+			: Vector()
 		{
+			if (&allocator != &Allocator::heap())
+				mAllocator = &allocator;
 		}
 
 		template<typename ...Args>
@@ -216,15 +258,38 @@ namespace StdExt::Collections
 			resize(init_size, std::forward<Args>(arguments)...);
 		}
 
-		template<size_t other_local, size_t other_block>
-		Vector(Vector<T, other_local, other_block>&& other)
+		/**
+		 * @brief
+		 *  Moves the elements of <i>other</i> to a new vector, which uses the allocator
+		 *  of <i>other</i>.
+		 */
+		Vector(Vector&& other)
+			: Vector()
+		{
+			mAllocator = other.mAllocator;
+			moveFrom(std::move(other));
+		}
+
+		/**
+		 * @brief
+		 *  Copies the elements of <i>other</i> to a new vector, which uses the global heap.
+		 */
+		Vector(const Vector& other)
 			: Vector()
 		{
+			copyFrom(other);
+		}
+
+		template<size_t other_local, bool other_auto_shrink, size_t other_block>
+		Vector(Vector<T, other_local, other_auto_shrink, other_block>&& other)
+			: Vector()
+		{
+			mAllocator = other.mAllocator;
 			moveFrom(std::move(other));
 		}
 
-		template<size_t other_local, size_t other_block>
-		Vector(const Vector<T, other_local, other_block>& other)
+		template<size_t other_local, bool other_auto_shrink, size_t other_block>
+		Vector(const Vector<T, other_local, other_auto_shrink, other_block>& other)
 			: Vector()
 		{
 			copyFrom(other);
@@ -233,22 +298,48 @@ namespace StdExt::Collections
 		virtual ~Vector()
 		{
 			destroy_n<T>(activeSpan());
+			freeAllocatedSpan();
 		}
 
-		template<size_t other_local, size_t other_block>
-		Vector& operator=(Vector<T, other_local, other_block>&& other)
+		Vector& operator=(Vector&& other)
+		{
+			if (this != &other)
+				moveFrom(std::move(other));
+
+			return *this;
+		}
+
+		Vector& operator=(const Vector& other)
+		{
+			if (this != &other)
+				copyFrom(other);
+
+			return *this;
+		}
+
+		template<size_t other_local, bool other_auto_shrink, size_t other_block>
+		Vector& operator=(Vector<T, other_local, other_auto_shrink, other_block>&& other)
 		{
 			moveFrom(std::move(other));
 			return *this;
 		}
 
-		template<size_t other_local, size_t other_block>
-		Vector& operator=(const Vector<T, other_local, other_block>& other)
+		template<size_t other_local, bool other_auto_shrink, size_t other_block>
+		Vector& operator=(const Vector<T, other_local, other_auto_shrink, other_block>& other)
 		{
 			copyFrom(other);
 			return *this;
 		}
 
+		/**
+		 * @brief
+		 *  The allocator of storage that is not local.
+		 */
+		Allocator& allocator() const noexcept
+		{
+			return (mAllocator) ? *mAllocator : Allocator::heap();
+		}
+
 		/**
 		 * @brief
 		 *  Resizes the vector to size.  If smaller than the current size, elements
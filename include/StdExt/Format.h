@@ -0,0 +1,432 @@
+#ifndef _STD_EXT_FORMAT_H_
+#define _STD_EXT_FORMAT_H_
+
+#include "String.h"
+#include "Number.h"
+#include "Exceptions.h"
+
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  Produces the text of a value for format() and toChars().
+	 *
+	 * @details
+	 *  A specialization is constructed from the value being formatted, and must provide
+	 *  <i>size()</i>, the length in characters of the text, and a
+	 *  <i>write<char_t>(char_t* out)</i> template that writes exactly that many characters
+	 *  to <i>out</i> and returns the position after them.  Any conversion work should be
+	 *  done on construction, since the size of every argument is needed before any text
+	 *  is written.
+	 */
+	template<typename T>
+	class Formatter;
+
+	namespace Detail
+	{
+		/**
+		 * @internal
+		 * @brief
+		 *  Holds the ASCII text of a number generated by std::to_chars.  Floating point
+		 *  values are written in the shortest form that round-trips.
+		 */
+		class NumericFormatter
+		{
+		public:
+			static constexpr size_t MaxLength = 32;
+
+			size_t size() const noexcept
+			{
+				return mSize;
+			}
+
+			template<Character char_t>
+			char_t* write(char_t* out) const noexcept
+			{
+				if constexpr ( sizeof(char_t) == 1 )
+				{
+					std::memcpy(out, mChars.data(), mSize);
+				}
+				else
+				{
+					for (size_t i = 0; i < mSize; ++i)
+						out[i] = static_cast<char_t>(mChars[i]);
+				}
+
+				return out + mSize;
+			}
+
+		protected:
+			template<Arithmetic T>
+			void convert(T value) noexcept
+			{
+				auto result = std::to_chars(mChars.data(), mChars.data() + MaxLength, value);
+				mSize = static_cast<uint8_t>(result.ptr - mChars.data());
+			}
+
+		private:
+			std::array<char, MaxLength> mChars;
+			uint8_t mSize = 0;
+		};
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Formats a fixed number of elements as a list separated by ", ", optionally
+		 *  enclosing each element in square brackets.
+		 */
+		template<typename element_formatter_t, size_t count, bool bracketed>
+		class ListFormatter
+		{
+		public:
+			template<typename container_t>
+			ListFormatter(const container_t& values)
+				: ListFormatter(values, std::make_index_sequence<count>())
+			{
+			}
+
+			size_t size() const noexcept
+			{
+				size_t ret = 2 * (count - 1);
+
+				if constexpr ( bracketed )
+					ret += 2 * count;
+
+				for (const auto& element : mElements)
+					ret += element.size();
+
+				return ret;
+			}
+
+			template<Character char_t>
+			char_t* write(char_t* out) const noexcept
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					if ( i > 0 )
+					{
+						*out++ = static_cast<char_t>(',');
+						*out++ = static_cast<char_t>(' ');
+					}
+
+					if constexpr ( bracketed )
+						*out++ = static_cast<char_t>('[');
+
+					out = mElements[i].template write<char_t>(out);
+
+					if constexpr ( bracketed )
+						*out++ = static_cast<char_t>(']');
+				}
+
+				return out;
+			}
+
+		private:
+			template<typename container_t, size_t ...indices>
+			ListFormatter(const container_t& values, std::index_sequence<indices...>)
+				: mElements{ element_formatter_t(values[indices])... }
+			{
+			}
+
+			std::array<element_formatter_t, count> mElements;
+		};
+
+		/**
+		 * @internal
+		 * @brief
+		 *  A type-erased reference to the formatter of a single format() argument.
+		 */
+		template<Character char_t>
+		struct FormatArg
+		{
+			const void* formatter;
+			size_t size;
+			char_t* (*write)(const void*, char_t*);
+
+			template<typename formatter_t>
+			static FormatArg of(const formatter_t& formatter) noexcept
+			{
+				return FormatArg{
+					&formatter, formatter.size(),
+					[](const void* f, char_t* out)
+					{
+						return static_cast<const formatter_t*>(f)->template write<char_t>(out);
+					}
+				};
+			}
+		};
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Measures the formatted text, then creates the result with at most one
+		 *  allocation and writes directly into it.
+		 */
+		template<Character char_t>
+		STD_EXT_EXPORT StringBase<char_t> formatArgs(
+			std::basic_string_view<char_t> fmt,
+			const FormatArg<char_t>* args,
+			size_t arg_count
+		);
+
+		template<Character char_t, typename ...args_t>
+		StringBase<char_t> format(std::basic_string_view<char_t> fmt, const args_t& ...args)
+		{
+			std::tuple<Formatter<std::decay_t<args_t>>...> formatters(args...);
+
+			auto erased = std::apply(
+				[](const auto& ...formatter)
+				{
+					return std::array<FormatArg<char_t>, sizeof...(args_t)>{
+						FormatArg<char_t>::of(formatter)...
+					};
+				},
+				formatters
+			);
+
+			return formatArgs<char_t>(fmt, erased.data(), erased.size());
+		}
+	}
+
+	template<Arithmetic T>
+	class Formatter<T> : public Detail::NumericFormatter
+	{
+	public:
+		Formatter(T value) noexcept
+		{
+			convert(value);
+		}
+	};
+
+	/**
+	 * @brief
+	 *  Formats a Number according to the type in which it is stored.
+	 */
+	template<>
+	class Formatter<Number> : public Detail::NumericFormatter
+	{
+	public:
+		Formatter(const Number& value)
+		{
+			const std::type_info& stored_as = value.storedAsInfo();
+
+			if ( typeid(int64_t) == stored_as )
+				convert(value.value<int64_t>());
+			else if ( typeid(uint64_t) == stored_as )
+				convert(value.value<uint64_t>());
+			else
+				convert(value.value<float64_t>());
+		}
+	};
+
+	/**
+	 * @brief
+	 *  Formats a bool as "true" or "false".
+	 */
+	template<>
+	class Formatter<bool>
+	{
+	public:
+		Formatter(bool value) noexcept
+			: mValue(value)
+		{
+		}
+
+		size_t size() const noexcept
+		{
+			return mValue ? 4 : 5;
+		}
+
+		template<Character char_t>
+		char_t* write(char_t* out) const noexcept
+		{
+			const char* text = mValue ? "true" : "false";
+
+			for (size_t i = 0; i < size(); ++i)
+				out[i] = static_cast<char_t>(text[i]);
+
+			return out + size();
+		}
+
+	private:
+		bool mValue;
+	};
+
+	/**
+	 * @brief
+	 *  Formats a single character.  It must be of the same type as the format string.
+	 */
+	template<Character T>
+	class Formatter<T>
+	{
+	public:
+		Formatter(T value) noexcept
+			: mValue(value)
+		{
+		}
+
+		size_t size() const noexcept
+		{
+			return 1;
+		}
+
+		template<Character char_t>
+		char_t* write(char_t* out) const noexcept
+		{
+			static_assert(std::same_as<T, char_t>, "Character arguments must match the format string type.");
+
+			*out = mValue;
+			return out + 1;
+		}
+
+	private:
+		T mValue;
+	};
+
+	/**
+	 * @brief
+	 *  Formats string data, which must be of the same character type as the format string.
+	 *  The formatter only references the data of the argument.
+	 */
+	template<Character T>
+	class Formatter<std::basic_string_view<T>>
+	{
+	public:
+		Formatter(std::basic_string_view<T> value) noexcept
+			: mValue(value)
+		{
+		}
+
+		size_t size() const noexcept
+		{
+			return mValue.size();
+		}
+
+		template<Character char_t>
+		char_t* write(char_t* out) const noexcept
+		{
+			static_assert(std::same_as<T, char_t>, "String arguments must match the format string type.");
+
+			std::memcpy(out, mValue.data(), mValue.size() * sizeof(char_t));
+			return out + mValue.size();
+		}
+
+	private:
+		std::basic_string_view<T> mValue;
+	};
+
+	template<Character T, size_t small_byte_size>
+	class Formatter<StringBase<T, small_byte_size>> : public Formatter<std::basic_string_view<T>>
+	{
+	public:
+		Formatter(const StringBase<T, small_byte_size>& value) noexcept
+			: Formatter<std::basic_string_view<T>>(value.view())
+		{
+		}
+	};
+
+	template<Character T>
+	class Formatter<std::basic_string<T>> : public Formatter<std::basic_string_view<T>>
+	{
+	public:
+		Formatter(const std::basic_string<T>& value) noexcept
+			: Formatter<std::basic_string_view<T>>(value)
+		{
+		}
+	};
+
+	template<Character T>
+	class Formatter<const T*> : public Formatter<std::basic_string_view<T>>
+	{
+	public:
+		Formatter(const T* value) noexcept
+			: Formatter<std::basic_string_view<T>>(value)
+		{
+		}
+	};
+
+	template<Character T>
+	class Formatter<T*> : public Formatter<const T*>
+	{
+	public:
+		Formatter(const T* value) noexcept
+			: Formatter<const T*>(value)
+		{
+		}
+	};
+
+	/**
+	 * @brief
+	 *  Creates a string by replacing each "{}" in <i>fmt</i> with the text of the next
+	 *  argument.  "{{" and "}}" are written as "{" and "}".
+	 *
+	 * @details
+	 *  Arguments are converted by their Formatter specialization, and the length of the
+	 *  result is calculated before anything is written, so the result is written directly
+	 *  into either local small string storage or a single heap allocation.  Arithmetic
+	 *  values are converted with std::to_chars, so floating point values use the shortest
+	 *  text that parses back to the same value.
+	 *
+	 * @throws format_error
+	 *  If <i>fmt</i> contains an unmatched brace or the number of placeholders does not
+	 *  match the number of arguments.
+	 */
+	template<Character char_t, typename ...args_t>
+	StringBase<char_t> format(std::basic_string_view<char_t> fmt, const args_t& ...args)
+	{
+		return Detail::format<char_t>(fmt, args...);
+	}
+
+	template<Character char_t, typename ...args_t>
+	StringBase<char_t> format(const char_t* fmt, const args_t& ...args)
+	{
+		return Detail::format<char_t>(std::basic_string_view<char_t>(fmt), args...);
+	}
+
+	template<Character char_t, size_t small_byte_size, typename ...args_t>
+	StringBase<char_t> format(const StringBase<char_t, small_byte_size>& fmt, const args_t& ...args)
+	{
+		return Detail::format<char_t>(fmt.view(), args...);
+	}
+
+	/**
+	 * @brief
+	 *  The length in characters of the text format() produces for <i>value</i>.
+	 */
+	template<typename T>
+	size_t formattedSize(const T& value)
+	{
+		return Formatter<std::decay_t<T>>(value).size();
+	}
+
+	/**
+	 * @brief
+	 *  Writes the text of <i>value</i> to the range [<i>first</i>, <i>last</i>) without
+	 *  allocating, returning the position after the written text.
+	 *
+	 * @throws std::out_of_range
+	 *  If the text does not fit in the range.  Nothing is written in that case.
+	 */
+	template<Character char_t, typename T>
+	char_t* toChars(char_t* first, char_t* last, const T& value)
+	{
+		Formatter<std::decay_t<T>> formatter(value);
+
+		if ( formatter.size() > static_cast<size_t>(last - first) )
+			throw std::out_of_range("Formatted text does not fit in the destination.");
+
+		return formatter.template write<char_t>(first);
+	}
+}
+
+#endif // !_STD_EXT_FORMAT_H_
@@ -0,0 +1,25 @@
+#ifndef _STD_EXT_HASH_H_
+#define _STD_EXT_HASH_H_
+
+#include "StdExt.h"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  Fast non-cryptographic hash of <i>byte_count</i> bytes starting at <i>data</i>.
+	 *
+	 * @details
+	 *  This is a wyhash style hash built on 64-bit multiply and fold operations.  Inputs
+	 *  of more than 48 bytes are consumed by three independent lanes per iteration so
+	 *  that the multiplies of each lane can execute in parallel.  Results are
+	 *  deterministic for a given platform and seed, but are not guaranteed to be stable
+	 *  between versions of the library, and should not be persisted.
+	 */
+	STD_EXT_EXPORT uint64_t hashBytes(const void* data, size_t byte_count, uint64_t seed = 0) noexcept;
+}
+
+#endif // !_STD_EXT_HASH_H_
@@ -0,0 +1,313 @@
+#ifndef _STD_EXT_INTERNED_STRING_H_
+#define _STD_EXT_INTERNED_STRING_H_
+
+#include "String.h"
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace StdExt
+{
+	template<Character char_t>
+	class InternedString;
+
+	/**
+	 * @brief
+	 *  Thread-safe set of unique strings.
+	 *
+	 * @details
+	 *  Interning a string returns an InternedString handle to the single pooled copy of
+	 *  its contents.  Pooled strings are kept for the lifetime of the pool, so handles
+	 *  can compare and hash by address alone.  The pool is split into shards, each with
+	 *  its own lock and hash table, so that threads interning different strings rarely
+	 *  contend.  Lookups of strings already in the pool only take a shared lock.
+	 */
+	template<Character char_t>
+	class StringPool final
+	{
+		friend class InternedString<char_t>;
+
+	public:
+		using string_t = StringBase<char_t>;
+		using view_t = typename string_t::view_t;
+		using handle_t = InternedString<char_t>;
+
+		/**
+		 * @brief
+		 *  The number of independently locked partitions of the pool.
+		 */
+		static constexpr size_t ShardCount = 16;
+
+		/**
+		 * @brief
+		 *  The process wide pool used by InternedString constructors.
+		 */
+		STD_EXT_EXPORT static StringPool& global();
+
+		StringPool(const StringPool&) = delete;
+		StringPool& operator=(const StringPool&) = delete;
+
+		StringPool() = default;
+
+		/**
+		 * @brief
+		 *  Returns the handle to the pooled copy of <i>str</i>, adding it to the pool if
+		 *  it is not already there.  A string that already owns null-terminated shared
+		 *  memory is added without copying its data.
+		 */
+		handle_t intern(const string_t& str)
+		{
+			return internImpl(str.view(), [&]() { return str.getNullTerminated(); });
+		}
+
+		handle_t intern(view_t str)
+		{
+			str = trimEnd(str);
+			return internImpl(str, [&]() { return string_t(str); });
+		}
+
+		handle_t intern(const char_t* str)
+		{
+			return intern(view_t(str));
+		}
+
+		/**
+		 * @brief
+		 *  Returns the handle to the pooled copy of <i>str</i> if it is in the pool,
+		 *  or a null handle otherwise.  The pool is not modified.
+		 */
+		handle_t find(view_t str) const
+		{
+			str = trimEnd(str);
+			Key key{ str, hashOf(str) };
+			const Shard& shard = shardFor(key.hash);
+
+			std::shared_lock lock(shard.mutex);
+			auto it = shard.strings.find(key);
+
+			return (it != shard.strings.end()) ? handle_t(it->second.get()) : handle_t();
+		}
+
+		/**
+		 * @brief
+		 *  The number of unique strings in the pool.
+		 */
+		size_t size() const
+		{
+			size_t ret = 0;
+
+			for (const Shard& shard : mShards)
+			{
+				std::shared_lock lock(shard.mutex);
+				ret += shard.strings.size();
+			}
+
+			return ret;
+		}
+
+	private:
+		/**
+		 * @internal
+		 * @brief
+		 *  Hash table key.  The view references the data of the pooled string, and the
+		 *  hash is stored so it is only calculated once per lookup.
+		 */
+		struct Key
+		{
+			view_t view;
+			size_t hash;
+
+			bool operator==(const Key& other) const noexcept
+			{
+				return view == other.view;
+			}
+		};
+
+		struct KeyHash
+		{
+			size_t operator()(const Key& key) const noexcept
+			{
+				return key.hash;
+			}
+		};
+
+		struct Shard
+		{
+			mutable std::shared_mutex mutex;
+			std::unordered_map<Key, std::unique_ptr<const string_t>, KeyHash> strings;
+		};
+
+		std::array<Shard, ShardCount> mShards;
+
+		static size_t hashOf(view_t str) noexcept
+		{
+			return std::hash<string_t>{}(str);
+		}
+
+		Shard& shardFor(size_t hash) noexcept
+		{
+			// Low bits select the bucket within a shard's table, so use high bits here.
+			return mShards[(hash >> (8 * sizeof(size_t) - 8)) % ShardCount];
+		}
+
+		const Shard& shardFor(size_t hash) const noexcept
+		{
+			return mShards[(hash >> (8 * sizeof(size_t) - 8)) % ShardCount];
+		}
+
+		template<typename make_string_t>
+		handle_t internImpl(view_t str, make_string_t&& makeString)
+		{
+			Key key{ str, hashOf(str) };
+			Shard& shard = shardFor(key.hash);
+
+			{
+				std::shared_lock lock(shard.mutex);
+				auto it = shard.strings.find(key);
+
+				if (it != shard.strings.end())
+					return handle_t(it->second.get());
+			}
+
+			std::unique_lock lock(shard.mutex);
+			auto it = shard.strings.find(key);
+
+			if (it != shard.strings.end())
+				return handle_t(it->second.get());
+
+			auto pooled = std::make_unique<const string_t>(makeString());
+			const string_t* ret = pooled.get();
+
+			// The key must view the pooled copy, which outlives the caller's string.
+			key.view = pooled->view();
+			shard.strings.emplace(key, std::move(pooled));
+
+			return handle_t(ret);
+		}
+	};
+
+	/**
+	 * @brief
+	 *  Handle to a string stored in a StringPool.
+	 *
+	 * @details
+	 *  Handles to equal strings from the same pool reference the same pooled string, so
+	 *  equality and hashing only compare addresses.  Handles from different pools never
+	 *  compare equal, and must not outlive their pool.  A default constructed handle is
+	 *  null.
+	 */
+	template<Character char_t>
+	class InternedString final
+	{
+		friend class StringPool<char_t>;
+
+	public:
+		using string_t = StringBase<char_t>;
+		using view_t = typename string_t::view_t;
+
+		InternedString() noexcept = default;
+
+		/**
+		 * @brief
+		 *  Interns <i>str</i> in the global pool.
+		 */
+		explicit InternedString(const string_t& str)
+			: InternedString(StringPool<char_t>::global().intern(str))
+		{
+		}
+
+		explicit InternedString(view_t str)
+			: InternedString(StringPool<char_t>::global().intern(str))
+		{
+		}
+
+		explicit InternedString(const char_t* str)
+			: InternedString(StringPool<char_t>::global().intern(str))
+		{
+		}
+
+		bool operator==(const InternedString& other) const noexcept
+		{
+			return mString == other.mString;
+		}
+
+		bool operator!=(const InternedString& other) const noexcept
+		{
+			return mString != other.mString;
+		}
+
+		/**
+		 * @brief
+		 *  Hash of the handle, which is derived from the address of the pooled string.
+		 */
+		size_t hash() const noexcept
+		{
+			return std::hash<const void*>{}(mString);
+		}
+
+		/**
+		 * @brief
+		 *  Returns the pooled string.  This shares the pooled memory and does not copy
+		 *  the character data.
+		 */
+		string_t toString() const
+		{
+			return (mString) ? *mString : string_t();
+		}
+
+		view_t view() const noexcept
+		{
+			return (mString) ? mString->view() : view_t();
+		}
+
+		const char_t* data() const noexcept
+		{
+			return (mString) ? mString->data() : nullptr;
+		}
+
+		size_t size() const noexcept
+		{
+			return (mString) ? mString->size() : 0;
+		}
+
+		bool isNull() const noexcept
+		{
+			return (nullptr == mString);
+		}
+
+	private:
+		explicit InternedString(const string_t* pooled) noexcept
+			: mString(pooled)
+		{
+		}
+
+		const string_t* mString = nullptr;
+	};
+
+	using CStringPool = StringPool<char>;
+	using U8StringPool = StringPool<char8_t>;
+	using U16StringPool = StringPool<char16_t>;
+	using U32StringPool = StringPool<char32_t>;
+	using WStringPool = StringPool<wchar_t>;
+
+	using CInternedString = InternedString<char>;
+	using U8InternedString = InternedString<char8_t>;
+	using U16InternedString = InternedString<char16_t>;
+	using U32InternedString = InternedString<char32_t>;
+	using WInternedString = InternedString<wchar_t>;
+}
+
+template<StdExt::Character char_t>
+struct std::hash<StdExt::InternedString<char_t>>
+{
+	size_t operator()(const StdExt::InternedString<char_t>& str) const noexcept
+	{
+		return str.hash();
+	}
+};
+
+#endif // !_STD_EXT_INTERNED_STRING_H_
@@ -732,6 +732,41 @@ namespace StdExt
 		}
 	};
 
+	/**
+	 * @brief
+	 *  Formats a matrix as its bracketed columns separated by ", ", such as
+	 *  "[1, 0], [0, 1]" for a 2x2 identity matrix.
+	 */
+	template<Arithmetic num_t>
+	class Formatter<Matrix2x2<num_t>> : public Detail::ListFormatter<Formatter<Vec2<num_t>>, 2, true>
+	{
+	public:
+		Formatter(const Matrix2x2<num_t>& value)
+			: Detail::ListFormatter<Formatter<Vec2<num_t>>, 2, true>(value)
+		{
+		}
+	};
+
+	template<Arithmetic num_t>
+	class Formatter<Matrix3x3<num_t>> : public Detail::ListFormatter<Formatter<Vec3<num_t>>, 3, true>
+	{
+	public:
+		Formatter(const Matrix3x3<num_t>& value)
+			: Detail::ListFormatter<Formatter<Vec3<num_t>>, 3, true>(value)
+		{
+		}
+	};
+
+	template<Arithmetic num_t>
+	class Formatter<Matrix4x4<num_t>> : public Detail::ListFormatter<Formatter<Vec4<num_t>>, 4, true>
+	{
+	public:
+		Formatter(const Matrix4x4<num_t>& value)
+			: Detail::ListFormatter<Formatter<Vec4<num_t>>, 4, true>(value)
+		{
+		}
+	};
+
 	namespace Serialize::Binary
 	{
 		template<>
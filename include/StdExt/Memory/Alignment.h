@@ -3,6 +3,9 @@
 
 #include "../Concepts.h"
 
+#include <array>
+#include <source_location>
+
 namespace StdExt
 {
 	/**
@@ -103,8 +106,13 @@ namespace StdExt
 	 *  Allocates size bytes of memory with the specified alignment. 
 	 *  The memory must be deallocated by using free_aligned() to
 	 *  avoid a memory leak.
+	 *
+	 * @param location
+	 *  The call site, which is recorded when the library is built with
+	 *  STD_EXT_TRACK_ALLOC.  See alloc_tracking_stats().
 	 */
-	void* alloc_aligned(size_t size, size_t alignment);
+	void* alloc_aligned(size_t size, size_t alignment,
+	                    const std::source_location& location = std::source_location::current());
 
 	/*
 	 * @brief
@@ -117,7 +125,60 @@ namespace StdExt
 	 *  Reallocates an alligned allocation.  It is an error
 	 *  to reallocate at a different allignment.
 	 */
-	void* realloc_aligned(void* ptr, size_t size, size_t alignment);
+	void* realloc_aligned(void* ptr, size_t size, size_t alignment,
+	                      const std::source_location& location = std::source_location::current());
+
+	/**
+	 * @brief
+	 *  Counters of the size-class pool that serves alloc_aligned() when the library is
+	 *  built with STD_EXT_POOLED_ALLOC.  All counters are zero otherwise.
+	 */
+	struct AllocPoolStats
+	{
+		static constexpr size_t SizeClassCount = 20;
+
+		/**
+		 * @brief
+		 *  Allocations and deallocations of blocks in the size classes.
+		 */
+		size_t pooledAllocations = 0;
+		size_t pooledDeallocations = 0;
+
+		/**
+		 * @brief
+		 *  Allocations and deallocations that were too large or aligned for the size
+		 *  classes, and were passed to the system allocator.
+		 */
+		size_t largeAllocations = 0;
+		size_t largeDeallocations = 0;
+
+		/**
+		 * @brief
+		 *  Slabs obtained from the system allocator for the size classes.
+		 */
+		size_t slabCount = 0;
+
+		/**
+		 * @brief
+		 *  Batches of free blocks moved between the caches of threads and the global
+		 *  free lists.
+		 */
+		size_t batchTransfers = 0;
+
+		/**
+		 * @brief
+		 *  The usable size of each size class, and the number of free blocks of each
+		 *  class on the global free lists.
+		 */
+		std::array<size_t, SizeClassCount> classSizes{};
+		std::array<size_t, SizeClassCount> globalFreeBlocks{};
+	};
+
+	/**
+	 * @brief
+	 *  Gets the counters of the allocation pool, summed over all threads.
+	 */
+	AllocPoolStats alloc_pool_stats();
 
 	/**
 	 * @brief
@@ -0,0 +1,116 @@
+#ifndef _STD_EXT_MEMORY_ALLOC_TRACKING_H_
+#define _STD_EXT_MEMORY_ALLOC_TRACKING_H_
+
+#include "../StdExt.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  The number of buckets in AllocTrackingStats::sizeHistogram.
+	 */
+	constexpr size_t AllocSizeBuckets = 64;
+
+	/**
+	 * @brief
+	 *  Allocation counters for a single call site of alloc_aligned(), realloc_aligned()
+	 *  or allocate_n().
+	 *
+	 * @details
+	 *  Memory freed is attributed to the site that allocated it, whichever thread frees
+	 *  it.  A reallocation counts as a deallocation at the site that made the original
+	 *  block and as an allocation at the site of the reallocation.
+	 */
+	struct AllocSiteStats
+	{
+		/**
+		 * @brief
+		 *  The file and function of the call site.  These point to static strings
+		 *  recorded by std::source_location.
+		 */
+		const char* file = nullptr;
+		const char* function = nullptr;
+		uint32_t line = 0;
+
+		size_t allocations = 0;
+		size_t deallocations = 0;
+		size_t bytesAllocated = 0;
+		size_t bytesFreed = 0;
+
+		size_t liveBytes() const noexcept
+		{
+			return bytesAllocated - bytesFreed;
+		}
+	};
+
+	/**
+	 * @brief
+	 *  Counters of allocations made through alloc_aligned() and related functions when
+	 *  the library is built with STD_EXT_TRACK_ALLOC.  All counters are zero and sites is
+	 *  empty otherwise.
+	 *
+	 * @details
+	 *  On Linux, buffers of a megabyte or more are mapped by Buffer directly from the
+	 *  system instead of using alloc_aligned(), so they are not included in any of these
+	 *  counters.
+	 */
+	struct AllocTrackingStats
+	{
+		/**
+		 * @brief
+		 *  Calls that allocated a new block, freed a block or resized a block.  A
+		 *  reallocation is only counted in reallocations.
+		 */
+		size_t allocations = 0;
+		size_t deallocations = 0;
+		size_t reallocations = 0;
+
+		/**
+		 * @brief
+		 *  The total bytes requested by allocations and reallocations.
+		 */
+		size_t bytesAllocated = 0;
+
+		/**
+		 * @brief
+		 *  Bytes currently allocated, and the most that have been allocated at once.
+		 *  Neither includes the headers of tracked allocations.
+		 */
+		size_t liveBytes = 0;
+		size_t peakBytes = 0;
+
+		/**
+		 * @brief
+		 *  Allocations and reallocations by requested size.  Bucket i counts sizes from
+		 *  2<sup>i-1</sup> up to 2<sup>i</sup> - 1 bytes, with the last bucket
+		 *  also counting all larger sizes.
+		 */
+		std::array<size_t, AllocSizeBuckets> sizeHistogram{};
+
+		/**
+		 * @brief
+		 *  Counters for each call site, in the order the sites were first seen.  The
+		 *  first entry, if present, has a null file and collects sites seen after the
+		 *  limit on tracked sites is reached, sites that do not fit in the site cache of
+		 *  the calling thread, and calls made while a thread is exiting.
+		 */
+		std::vector<AllocSiteStats> sites;
+	};
+
+	/**
+	 * @brief
+	 *  Gets a snapshot of the allocation counters, summed over all threads.
+	 *
+	 * @details
+	 *  Threads keep their counters without synchronizing, so counts for allocations
+	 *  happening during the snapshot may or may not be included.
+	 */
+	AllocTrackingStats alloc_tracking_stats();
+}
+
+#endif // !_STD_EXT_MEMORY_ALLOC_TRACKING_H_
@@ -0,0 +1,47 @@
+#ifndef _STD_EXT_MEMORY_ALLOCATOR_H_
+#define _STD_EXT_MEMORY_ALLOCATOR_H_
+
+#include "../StdExt.h"
+
+#include <cstddef>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  A source of memory that containers can be given to route their allocations away
+	 *  from the global heap.
+	 *
+	 * @details
+	 *  Containers keep a pointer to the allocator of their memory and return it to the
+	 *  same allocator, so the allocator must outlive every container using it.  Sizes and
+	 *  alignments passed to deallocate() are the same as those passed to allocate().
+	 */
+	class STD_EXT_EXPORT Allocator
+	{
+	public:
+		virtual ~Allocator();
+
+		/**
+		 * @brief
+		 *  Allocates <i>size</i> bytes aligned to <i>alignment</i>, which is a power of
+		 *  two.  Throws std::bad_alloc if the memory cannot be allocated.
+		 */
+		virtual void* allocate(size_t size, size_t alignment) = 0;
+
+		/**
+		 * @brief
+		 *  Returns memory obtained from allocate().
+		 */
+		virtual void deallocate(void* ptr, size_t size, size_t alignment) noexcept = 0;
+
+		/**
+		 * @brief
+		 *  The allocator using alloc_aligned() and free_aligned(), which containers use
+		 *  when they are not given an allocator.
+		 */
+		static Allocator& heap() noexcept;
+	};
+}
+
+#endif // !_STD_EXT_MEMORY_ALLOCATOR_H_
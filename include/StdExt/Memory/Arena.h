@@ -0,0 +1,93 @@
+#ifndef _STD_EXT_MEMORY_ARENA_H_
+#define _STD_EXT_MEMORY_ARENA_H_
+
+#include "Allocator.h"
+
+#include <cstddef>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  Allocator that hands out memory by advancing a pointer through blocks obtained
+	 *  from alloc_aligned(), and frees everything at once with release() or reset().
+	 *
+	 * @details
+	 *  When the current block is exhausted, a new block is chained to the arena, doubling
+	 *  in size up to MaxBlockSize or the size of the allocation requested.  deallocate()
+	 *  only reclaims the most recent allocation, which lets containers that grow by
+	 *  reallocating reuse their previous space.  Any other memory is only reclaimed
+	 *  when the whole arena is released.
+	 *
+	 *  This makes allocation a few instructions in the common case and keeps objects
+	 *  built together close in memory, which suits short lived groups of containers
+	 *  such as those built while processing a single request or frame.
+	 *
+	 * @note
+	 *  An arena is not thread safe.  Containers using it must be destroyed, or no
+	 *  longer used, before it is released.
+	 */
+	class STD_EXT_EXPORT MonotonicArena final : public Allocator
+	{
+	public:
+		static constexpr size_t DefaultBlockSize = 4096;
+		static constexpr size_t MaxBlockSize = 1024 * 1024;
+
+		/**
+		 * @brief
+		 *  Creates an arena without allocating a block.  The first block will hold at
+		 *  least <i>block_size</i> bytes including a small header.
+		 */
+		explicit MonotonicArena(size_t block_size = DefaultBlockSize);
+
+		MonotonicArena(const MonotonicArena&) = delete;
+		MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+		~MonotonicArena() override;
+
+		void* allocate(size_t size, size_t alignment) override;
+		void deallocate(void* ptr, size_t size, size_t alignment) noexcept override;
+
+		/**
+		 * @brief
+		 *  Frees all blocks of the arena, invalidating all memory it has allocated.
+		 */
+		void release() noexcept;
+
+		/**
+		 * @brief
+		 *  Invalidates all memory the arena has allocated, freeing all blocks except the
+		 *  largest, which is reused for later allocations.
+		 */
+		void reset() noexcept;
+
+		/**
+		 * @brief
+		 *  The number of bytes handed out since the arena was last released or reset,
+		 *  not including alignment padding.
+		 */
+		size_t bytesUsed() const noexcept;
+
+		/**
+		 * @brief
+		 *  The total size of the blocks currently held by the arena.
+		 */
+		size_t capacity() const noexcept;
+
+	private:
+		struct Block;
+
+		void addBlock(size_t size, size_t alignment);
+
+		Block* mBlocks;
+		std::byte* mCurrent;
+		std::byte* mEnd;
+
+		size_t mInitialBlockSize;
+		size_t mNextBlockSize;
+		size_t mBytesUsed;
+		size_t mCapacity;
+	};
+}
+
+#endif // !_STD_EXT_MEMORY_ARENA_H_
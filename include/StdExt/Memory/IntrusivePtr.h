@@ -0,0 +1,332 @@
+#ifndef _STD_EXT_MEMORY_INTRUSIVE_PTR_H_
+#define _STD_EXT_MEMORY_INTRUSIVE_PTR_H_
+
+#include "../Concepts.h"
+#include "../Exceptions.h"
+
+#include "RefCount.h"
+#include "TaggedPtr.h"
+
+#include <concepts>
+#include <utility>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  Base class that stores the reference count of an object inside the object itself,
+	 *  for use with IntrusivePtr.
+	 *
+	 * @details
+	 *  Keeping the count in the object avoids the separate control block of SharedPtr, so
+	 *  copying a reference and accessing the object touch the same memory.  A newly
+	 *  constructed object starts with one reference that belongs to its creator, which
+	 *  IntrusivePtr::adopt() or makeIntrusive() take over.  When the last reference is
+	 *  released, the object is deleted as <i>derived_t</i>.  Objects must therefore be
+	 *  allocated with new, and classes deriving from <i>derived_t</i> need a virtual
+	 *  destructor.
+	 *
+	 * @tparam derived_t
+	 *  The class deriving from IntrusiveRefCounted.
+	 *
+	 * @tparam ref_count_t
+	 *  The reference counting policy.  LocalRefCount can be used for objects that are
+	 *  only referenced from a single thread.
+	 */
+	template<typename derived_t, ReferenceCounter ref_count_t = AtomicRefCount>
+	class IntrusiveRefCounted
+	{
+	public:
+		void addReference() const noexcept
+		{
+			mRefCount.increment();
+		}
+
+		void releaseReference() const noexcept
+		{
+			if ( mRefCount.decrement() )
+				delete static_cast<const derived_t*>(this);
+		}
+
+		int referenceCount() const noexcept
+		{
+			return mRefCount.count();
+		}
+
+	protected:
+		IntrusiveRefCounted() noexcept = default;
+
+		/**
+		 * @brief
+		 *  A copy of an object is a new object, so it starts with its own count.
+		 */
+		IntrusiveRefCounted(const IntrusiveRefCounted&) noexcept
+		{
+		}
+
+		IntrusiveRefCounted& operator=(const IntrusiveRefCounted&) noexcept
+		{
+			return *this;
+		}
+
+		~IntrusiveRefCounted() = default;
+
+	private:
+		mutable ref_count_t mRefCount;
+	};
+
+	/**
+	 * @brief
+	 *  Passes for types that manage their own reference count, such as classes
+	 *  derived from IntrusiveRefCounted.
+	 */
+	template<typename T>
+	concept IntrusivelyCounted = requires (const T& obj)
+	{
+		obj.addReference();
+		obj.releaseReference();
+	};
+
+	/**
+	 * @brief
+	 *  Reference to an object that stores its own reference count.  The pointer is the
+	 *  size of a raw pointer, and dereferencing it does not go through a control block.
+	 *
+	 * @note
+	 *  As with SharedPtr, the IntrusivePtr object itself is not thread safe.  Whether
+	 *  references on different threads can share an object depends on the reference
+	 *  counting policy of the object.  T can be incomplete where the pointer is declared,
+	 *  so objects can hold references to others of their own type.
+	 */
+	template<typename T>
+	class IntrusivePtr final
+	{
+		template<typename U>
+		friend class IntrusivePtr;
+
+	public:
+		constexpr IntrusivePtr() noexcept = default;
+
+		constexpr IntrusivePtr(std::nullptr_t) noexcept
+		{
+		}
+
+		/**
+		 * @brief
+		 *  Adds a reference to <i>ptr</i>.
+		 */
+		explicit IntrusivePtr(T* ptr) noexcept
+			: mPtr(ptr)
+		{
+			if (mPtr)
+				mPtr->addReference();
+		}
+
+		IntrusivePtr(const IntrusivePtr& other) noexcept
+			: IntrusivePtr(other.mPtr)
+		{
+		}
+
+		IntrusivePtr(IntrusivePtr&& other) noexcept
+			: mPtr(std::exchange(other.mPtr, nullptr))
+		{
+		}
+
+		template<typename U>
+			requires std::convertible_to<U*, T*>
+		IntrusivePtr(const IntrusivePtr<U>& other) noexcept
+			: IntrusivePtr(static_cast<T*>(other.mPtr))
+		{
+		}
+
+		template<typename U>
+			requires std::convertible_to<U*, T*>
+		IntrusivePtr(IntrusivePtr<U>&& other) noexcept
+			: mPtr(std::exchange(other.mPtr, nullptr))
+		{
+		}
+
+		~IntrusivePtr()
+		{
+			clear();
+		}
+
+		/**
+		 * @brief
+		 *  Takes over a reference that is already counted, such as the initial reference
+		 *  of a newly constructed object or one returned by release().
+		 */
+		static IntrusivePtr adopt(T* ptr) noexcept
+		{
+			IntrusivePtr ret;
+			ret.mPtr = ptr;
+
+			return ret;
+		}
+
+		IntrusivePtr& operator=(const IntrusivePtr& other) noexcept
+		{
+			IntrusivePtr(other).swap(*this);
+			return *this;
+		}
+
+		IntrusivePtr& operator=(IntrusivePtr&& other) noexcept
+		{
+			IntrusivePtr(std::move(other)).swap(*this);
+			return *this;
+		}
+
+		void swap(IntrusivePtr& other) noexcept
+		{
+			std::swap(mPtr, other.mPtr);
+		}
+
+		/**
+		 * @brief
+		 *  Gives up the reference without releasing it, returning the raw pointer.  The
+		 *  reference must later be passed to adopt() or released manually.
+		 */
+		[[nodiscard]] T* release() noexcept
+		{
+			return std::exchange(mPtr, nullptr);
+		}
+
+		void clear() noexcept
+		{
+			if (mPtr)
+				std::exchange(mPtr, nullptr)->releaseReference();
+		}
+
+		T* get() const noexcept
+		{
+			return mPtr;
+		}
+
+		T* operator->() const noexcept
+		{
+			return mPtr;
+		}
+
+		T& operator*() const
+		{
+			if (mPtr)
+				return *mPtr;
+
+			throw null_pointer("Attempting to dereference a null pointer.");
+		}
+
+		explicit operator bool() const noexcept
+		{
+			return (nullptr != mPtr);
+		}
+
+		template<typename U>
+		bool operator==(const IntrusivePtr<U>& other) const noexcept
+		{
+			return (mPtr == other.mPtr);
+		}
+
+	private:
+		T* mPtr = nullptr;
+	};
+
+	/**
+	 * @brief
+	 *  Creates an object with new and adopts its initial reference.
+	 */
+	template<IntrusivelyCounted T, typename ...args_t>
+	IntrusivePtr<T> makeIntrusive(args_t&& ...arguments)
+	{
+		return IntrusivePtr<T>::adopt(new T(std::forward<args_t>(arguments)...));
+	}
+
+	/**
+	 * @brief
+	 *  An owning reference to an intrusively counted object packed with an 8-bit tag in
+	 *  a TaggedPtr, so a reference and a small piece of state take a single 64-bit word.
+	 */
+	template<typename tag_t, typename T>
+		requires (sizeof(tag_t) == 1)
+	class TaggedIntrusivePtr final
+	{
+	public:
+		TaggedIntrusivePtr() = default;
+
+		TaggedIntrusivePtr(tag_t tag, IntrusivePtr<T> ptr) noexcept
+			: mTaggedPtr(tag, ptr.release())
+		{
+		}
+
+		TaggedIntrusivePtr(const TaggedIntrusivePtr& other) noexcept
+			: mTaggedPtr(other.mTaggedPtr)
+		{
+			if (T* ptr = get())
+				ptr->addReference();
+		}
+
+		TaggedIntrusivePtr(TaggedIntrusivePtr&& other) noexcept
+			: mTaggedPtr(other.mTaggedPtr)
+		{
+			other.mTaggedPtr.setPtr(nullptr);
+		}
+
+		~TaggedIntrusivePtr()
+		{
+			if (T* ptr = get())
+				ptr->releaseReference();
+		}
+
+		TaggedIntrusivePtr& operator=(TaggedIntrusivePtr other) noexcept
+		{
+			std::swap(mTaggedPtr, other.mTaggedPtr);
+			return *this;
+		}
+
+		tag_t tag() const
+		{
+			return mTaggedPtr.tag();
+		}
+
+		void setTag(tag_t tag)
+		{
+			mTaggedPtr.setTag(tag);
+		}
+
+		T* get() const
+		{
+			return const_cast<T*>(mTaggedPtr.ptr());
+		}
+
+		T* operator->() const
+		{
+			return get();
+		}
+
+		/**
+		 * @brief
+		 *  Replaces the referenced object, keeping the tag.
+		 */
+		void setPtr(IntrusivePtr<T> ptr) noexcept
+		{
+			T* previous = get();
+			mTaggedPtr.setPtr(ptr.release());
+
+			if (previous)
+				previous->releaseReference();
+		}
+
+		/**
+		 * @brief
+		 *  Gets a separate IntrusivePtr reference to the object.
+		 */
+		IntrusivePtr<T> toIntrusivePtr() const noexcept
+		{
+			return IntrusivePtr<T>(get());
+		}
+
+	private:
+		TaggedPtr<tag_t, T*> mTaggedPtr;
+	};
+}
+
+#endif // !_STD_EXT_MEMORY_INTRUSIVE_PTR_H_
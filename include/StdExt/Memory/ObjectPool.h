@@ -0,0 +1,299 @@
+#ifndef _STD_EXT_MEMORY_OBJECT_POOL_H_
+#define _STD_EXT_MEMORY_OBJECT_POOL_H_
+
+#include "../StdExt.h"
+
+#include "Alignment.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  The cache line size assumed when padding objects to avoid false sharing.
+	 */
+	constexpr size_t CacheLineSize = 64;
+
+	namespace Detail
+	{
+		/**
+		 * @internal
+		 * @brief
+		 *  Recycles fixed size slots for ObjectPool, independent of the type stored in them.
+		 *
+		 * @details
+		 *  Free slots are held in magazines of MagazineSize slot pointers.  Each thread
+		 *  keeps one magazine per pool, so allocation and release do not synchronize until
+		 *  the magazine of the thread is empty or full.  It is then exchanged for one from
+		 *  the lock-free stacks of full and empty magazines the pool shares between threads.
+		 *  New slots are only carved from chunks under a lock when no full magazine is
+		 *  available.
+		 *
+		 *  Magazines are referenced by index in the shared stacks, which leaves room for a
+		 *  32-bit tag that protects the stacks against ABA.  Magazines and chunks are kept
+		 *  until the pool is destroyed, and magazines held by a thread are returned to the
+		 *  pool when the thread exits.
+		 */
+		class STD_EXT_EXPORT ObjectPoolBase
+		{
+		public:
+			static constexpr size_t MagazineSize = 32;
+			static constexpr size_t MaxChunkSlots = 4096;
+
+			ObjectPoolBase(size_t slot_size, size_t slot_alignment);
+
+			ObjectPoolBase(const ObjectPoolBase&) = delete;
+			ObjectPoolBase& operator=(const ObjectPoolBase&) = delete;
+
+			~ObjectPoolBase();
+
+			void* allocateSlot();
+			void freeSlot(void* slot) noexcept;
+
+			size_t capacity() const noexcept;
+
+			/**
+			 * @internal
+			 * @brief
+			 *  Returns a magazine held by an exiting thread to the shared stacks.
+			 */
+			void returnMagazine(void* magazine) noexcept;
+
+		private:
+			struct Magazine;
+			struct Chunk;
+
+			static constexpr size_t MagazineBlockCount = 27;
+			static constexpr size_t FirstMagazineBlockSize = 16;
+
+			Magazine** localMagazine() noexcept;
+
+			void* allocateFrom(Magazine*& magazine);
+			void freeTo(Magazine*& magazine, void* slot) noexcept;
+
+			void push(std::atomic<uint64_t>& stack, Magazine* magazine) noexcept;
+			Magazine* pop(std::atomic<uint64_t>& stack) noexcept;
+
+			Magazine* magazineAt(uint32_t index) const noexcept;
+			Magazine* takeEmptyMagazine() noexcept;
+			void fill(Magazine* magazine);
+
+			const size_t mSlotSize;
+			const size_t mSlotAlignment;
+
+			uint64_t mSerial;
+			size_t mIndex;
+
+			std::atomic<uint64_t> mFullMagazines;
+			std::atomic<uint64_t> mEmptyMagazines;
+			std::atomic<Magazine*> mMagazineBlocks[MagazineBlockCount];
+
+			std::mutex mGrowthMutex;
+			uint32_t mMagazineCount;
+			Chunk* mChunks;
+			std::byte* mCarve;
+			std::byte* mCarveEnd;
+			size_t mNextChunkSlots;
+			std::atomic<size_t> mCapacity;
+
+			std::mutex mSharedMutex;
+			Magazine* mShared;
+		};
+	}
+
+	/**
+	 * @brief
+	 *  Creates and destroys objects of type T in slots that are recycled rather than
+	 *  returned to the heap.
+	 *
+	 * @details
+	 *  This suits objects that are created and destroyed at high rates from many threads.
+	 *  Each thread keeps a small magazine of free slots for the pool, so most creations
+	 *  and destructions touch neither the heap nor memory shared with other threads.
+	 *  Objects can be destroyed on a different thread than the one that created them.
+	 *
+	 *  When <i>cache_line_padded</i> is true, each slot is aligned and padded to
+	 *  CacheLineSize, so objects used by different threads never share a cache line.
+	 *
+	 * @note
+	 *  All objects of a pool must be destroyed before the pool is.
+	 */
+	template<typename T, bool cache_line_padded = false>
+	class ObjectPool
+	{
+	private:
+		static constexpr size_t SlotAlignment = cache_line_padded ?
+			std::max(alignof(T), CacheLineSize) : alignof(T);
+
+		struct alignas(SlotAlignment) Slot
+		{
+			AlignedStorage<T, 1> storage;
+		};
+
+		Detail::ObjectPoolBase mSlots;
+
+	public:
+
+		/**
+		 * @brief
+		 *  Owns an object created by an ObjectPool, destroying it and returning its slot
+		 *  to the pool when the handle is reset or destroyed.
+		 */
+		class Handle
+		{
+			friend class ObjectPool;
+
+		private:
+			ObjectPool* mPool = nullptr;
+			T* mObject = nullptr;
+
+			Handle(ObjectPool* pool, T* object) noexcept
+				: mPool(pool), mObject(object)
+			{
+			}
+
+		public:
+			constexpr Handle() noexcept = default;
+
+			Handle(const Handle&) = delete;
+			Handle& operator=(const Handle&) = delete;
+
+			Handle(Handle&& other) noexcept
+				: mPool(std::exchange(other.mPool, nullptr)),
+				  mObject(std::exchange(other.mObject, nullptr))
+			{
+			}
+
+			Handle& operator=(Handle&& other) noexcept
+			{
+				if (this != &other)
+				{
+					reset();
+
+					mPool = std::exchange(other.mPool, nullptr);
+					mObject = std::exchange(other.mObject, nullptr);
+				}
+
+				return *this;
+			}
+
+			~Handle()
+			{
+				reset();
+			}
+
+			/**
+			 * @brief
+			 *  Destroys the object, returning its slot to the pool.
+			 */
+			void reset() noexcept
+			{
+				if (mObject)
+					mPool->destroy( std::exchange(mObject, nullptr) );
+
+				mPool = nullptr;
+			}
+
+			/**
+			 * @brief
+			 *  Gives up ownership of the object without destroying it.  It must later be
+			 *  passed to destroy() of the pool that created it.
+			 */
+			T* release() noexcept
+			{
+				mPool = nullptr;
+				return std::exchange(mObject, nullptr);
+			}
+
+			T* get() const noexcept
+			{
+				return mObject;
+			}
+
+			T* operator->() const noexcept
+			{
+				return mObject;
+			}
+
+			T& operator*() const noexcept
+			{
+				return *mObject;
+			}
+
+			explicit operator bool() const noexcept
+			{
+				return nullptr != mObject;
+			}
+		};
+
+		ObjectPool()
+			: mSlots(sizeof(Slot), alignof(Slot))
+		{
+		}
+
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+
+		/**
+		 * @brief
+		 *  Constructs an object in a recycled slot, or in a new one if the pool has none free.
+		 */
+		template<typename ...args_t>
+		T* create(args_t&& ...args)
+		{
+			Slot* slot = static_cast<Slot*>(mSlots.allocateSlot());
+
+			try
+			{
+				return new (slot->storage[0]) T(std::forward<args_t>(args)...);
+			}
+			catch (...)
+			{
+				mSlots.freeSlot(slot);
+				throw;
+			}
+		}
+
+		/**
+		 * @brief
+		 *  Destroys an object created by this pool and recycles its slot.
+		 */
+		void destroy(T* object) noexcept
+		{
+			if (nullptr == object)
+				return;
+
+			std::destroy_at(object);
+			mSlots.freeSlot(object);
+		}
+
+		/**
+		 * @brief
+		 *  Constructs an object in the pool, returning a Handle that owns it.
+		 */
+		template<typename ...args_t>
+		Handle make(args_t&& ...args)
+		{
+			return Handle(this, create(std::forward<args_t>(args)...));
+		}
+
+		/**
+		 * @brief
+		 *  The number of slots the pool has carved, whether in use or free.
+		 */
+		size_t capacity() const noexcept
+		{
+			return mSlots.capacity();
+		}
+	};
+}
+
+#endif // !_STD_EXT_MEMORY_OBJECT_POOL_H_
@@ -0,0 +1,126 @@
+#ifndef _STD_EXT_MEMORY_REF_COUNT_H_
+#define _STD_EXT_MEMORY_REF_COUNT_H_
+
+#include <atomic>
+#include <concepts>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  A reference counting policy for the shared memory types.  A counter starts at one,
+	 *  and decrement() returns true when the last reference is released.  tryIncrement()
+	 *  adds a reference only if the count has not already reached zero, which is how
+	 *  weak references gain ownership.
+	 */
+	template<typename T>
+	concept ReferenceCounter = std::default_initializable<T> &&
+		requires (T& counter, const T& const_counter)
+		{
+			{ counter.increment() } -> std::same_as<void>;
+			{ counter.decrement() } -> std::same_as<bool>;
+			{ counter.tryIncrement() } -> std::same_as<bool>;
+			{ const_counter.count() } -> std::same_as<int>;
+		};
+
+	/**
+	 * @brief
+	 *  Reference count that can be shared by references on different threads.  This is
+	 *  the default policy of SharedArray, SharedData and SharedPtr.
+	 *
+	 * @details
+	 *  Increments are relaxed since a thread can only add a reference through one it
+	 *  already holds.  The decrement that releases the last reference synchronizes with
+	 *  all previous decrements, so every use of the shared object happens before it is
+	 *  destroyed.
+	 */
+	class AtomicRefCount final
+	{
+	public:
+		AtomicRefCount() noexcept = default;
+
+		AtomicRefCount(const AtomicRefCount&) = delete;
+		AtomicRefCount& operator=(const AtomicRefCount&) = delete;
+
+		void increment() noexcept
+		{
+			mCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		bool tryIncrement() noexcept
+		{
+			int count = mCount.load(std::memory_order_relaxed);
+
+			while ( 0 != count )
+			{
+				if ( mCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed) )
+					return true;
+			}
+
+			return false;
+		}
+
+		bool decrement() noexcept
+		{
+			if ( 1 == mCount.fetch_sub(1, std::memory_order_release) )
+			{
+				std::atomic_thread_fence(std::memory_order_acquire);
+				return true;
+			}
+
+			return false;
+		}
+
+		int count() const noexcept
+		{
+			return mCount.load(std::memory_order_acquire);
+		}
+
+	private:
+		std::atomic<int> mCount = 1;
+	};
+
+	/**
+	 * @brief
+	 *  Reference count without synchronization, for objects whose references are all
+	 *  created, copied, and released on a single thread.  This avoids the locked
+	 *  read-modify-write of AtomicRefCount on every copy and release.
+	 */
+	class LocalRefCount final
+	{
+	public:
+		LocalRefCount() noexcept = default;
+
+		LocalRefCount(const LocalRefCount&) = delete;
+		LocalRefCount& operator=(const LocalRefCount&) = delete;
+
+		void increment() noexcept
+		{
+			++mCount;
+		}
+
+		bool tryIncrement() noexcept
+		{
+			if ( 0 == mCount )
+				return false;
+
+			++mCount;
+			return true;
+		}
+
+		bool decrement() noexcept
+		{
+			return (0 == --mCount);
+		}
+
+		int count() const noexcept
+		{
+			return mCount;
+		}
+
+	private:
+		int mCount = 1;
+	};
+}
+
+#endif // !_STD_EXT_MEMORY_REF_COUNT_H_
@@ -2,26 +2,32 @@
 #define _STD_EXT_MEMORY_SHARED_DATA_H_
 
 #include "../Concepts.h"
+#include "../Exceptions.h"
 #include "../Utility.h"
 
 #include "Alignment.h"
+#include "RefCount.h"
 
-#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
 
 namespace StdExt
 {
 	namespace Detail
 	{
-		template<typename metadata_t>
+		template<typename metadata_t, ReferenceCounter ref_count_t>
 		class SharedBlockData
 		{
 		public:
 			SharedBlockData() = default;
 			virtual ~SharedBlockData() = default;
 
-			using my_t = SharedBlockData<metadata_t>;
+			using my_t = SharedBlockData<metadata_t, ref_count_t>;
 			
-			mutable std::atomic<int> refCount = 1;
+			mutable ref_count_t refCount;
 			void* dataPtr = nullptr;
 			size_t size = 0;
 			metadata_t metadata{};
@@ -48,16 +54,16 @@ namespace StdExt
 			}
 		};
 
-		template<>
-		class SharedBlockData<void>
+		template<ReferenceCounter ref_count_t>
+		class SharedBlockData<void, ref_count_t>
 		{
 		public:
 			SharedBlockData() = default;
 			virtual ~SharedBlockData() = default;
 
-			using my_t = SharedBlockData<void>;
+			using my_t = SharedBlockData<void, ref_count_t>;
 
-			mutable std::atomic<int> refCount = 1;
+			mutable ref_count_t refCount;
 			void* dataPtr = nullptr;
 			size_t size = 0;
 
@@ -92,17 +98,22 @@ namespace StdExt
 	 * @tparam metadata_t
 	 *  Data type of optional metadata to supplement the raw shared data.  Default void
 	 *  type can be used to specify no metadata.
+	 *
+	 * @tparam ref_count_t
+	 *  The reference counting policy.  LocalRefCount can be used for data that is only
+	 *  referenced from a single thread.
 	 */
-	template<DefaultConstructible metadata_t = void>
+	template<typename metadata_t = void, ReferenceCounter ref_count_t = AtomicRefCount>
+		requires Void<metadata_t> || DefaultConstructible<metadata_t>
 	class SharedData
 	{
 	private:
-		using control_block_t = Detail::SharedBlockData<metadata_t>;
+		using control_block_t = Detail::SharedBlockData<metadata_t, ref_count_t>;
 		control_block_t* mControlBlock;
 
 		void release()
 		{
-			if (nullptr != mControlBlock && 0 == --mControlBlock->refCount)
+			if (nullptr != mControlBlock && mControlBlock->refCount.decrement())
 				control_block_t::free(mControlBlock);
 						
 			mControlBlock = nullptr;
@@ -141,7 +152,7 @@ namespace StdExt
 			control_block_t* otherBlock = other.mControlBlock;
 		
 			if (nullptr != otherBlock)
-				++otherBlock->refCount;
+				otherBlock->refCount.increment();
 
 			mControlBlock = otherBlock;
 		}
@@ -179,7 +190,7 @@ namespace StdExt
 				control_block_t* otherBlock = other.mControlBlock;
 
 				if (nullptr != otherBlock)
-					++otherBlock->refCount;
+					otherBlock->refCount.increment();
 
 				mControlBlock = otherBlock;
 			}
@@ -279,6 +290,181 @@ namespace StdExt
 			return (nullptr != mControlBlock);
 		}
 	};
+
+	/**
+	 * @brief
+	 *  A range of bytes within SharedData that shares ownership of the whole block.
+	 *
+	 * @details
+	 *  Views are an offset and length along with a reference to the parent block, so a
+	 *  single received buffer can be split into parts that are handed to different
+	 *  consumers without copying.  The block is freed when the last SharedData or
+	 *  SharedDataView referencing it is released.
+	 */
+	template<typename metadata_t = void, ReferenceCounter ref_count_t = AtomicRefCount>
+		requires Void<metadata_t> || DefaultConstructible<metadata_t>
+	class SharedDataView
+	{
+	public:
+		using shared_data_t = SharedData<metadata_t, ref_count_t>;
+
+		static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+		SharedDataView() noexcept = default;
+
+		/**
+		 * @brief
+		 *  Creates a view of all of <i>data</i>.
+		 */
+		SharedDataView(shared_data_t data) noexcept
+			: mSize(data.size()), mData(std::move(data))
+		{
+		}
+
+		/**
+		 * @brief
+		 *  Creates a view of <i>size</i> bytes of <i>data</i> starting at <i>offset</i>.
+		 *  If <i>size</i> is npos, the view extends to the end of the data.
+		 *
+		 * @throws std::out_of_range
+		 *  If the range is not within <i>data</i>.
+		 */
+		SharedDataView(shared_data_t data, size_t offset, size_t size = npos)
+			: SharedDataView(std::move(data))
+		{
+			*this = subview(offset, size);
+		}
+
+		/**
+		 * @brief
+		 *  Gets a view of a range within this view that shares the same parent block.
+		 *  If <i>size</i> is npos, the new view extends to the end of this one.
+		 *
+		 * @throws std::out_of_range
+		 *  If the range is not within this view.
+		 */
+		SharedDataView subview(size_t offset, size_t size = npos) const
+		{
+			if ( offset > mSize )
+				throw std::out_of_range("Subview offset is past the end of the view.");
+
+			if ( npos == size )
+				size = mSize - offset;
+			else if ( size > mSize - offset )
+				throw std::out_of_range("Subview extends past the end of the view.");
+
+			SharedDataView ret(*this);
+			ret.mOffset += offset;
+			ret.mSize = size;
+
+			return ret;
+		}
+
+		/**
+		 * @brief
+		 *  The size of the view in bytes.
+		 */
+		size_t size() const noexcept
+		{
+			return mSize;
+		}
+
+		/**
+		 * @brief
+		 *  The offset of the view from the start of the parent data.
+		 */
+		size_t offset() const noexcept
+		{
+			return mOffset;
+		}
+
+		void* data()
+		{
+			return (mData) ? static_cast<uint8_t*>(mData.data()) + mOffset : nullptr;
+		}
+
+		const void* data() const
+		{
+			return (mData) ? static_cast<const uint8_t*>(mData.data()) + mOffset : nullptr;
+		}
+
+		/**
+		 * @brief
+		 *  The contents of the view as elements of T.
+		 *
+		 * @throws invalid_operation
+		 *  If the view does not start at an address aligned for T, or its size is not a
+		 *  multiple of the size of T.
+		 */
+		template<typename T>
+			requires std::is_trivially_copyable_v<T>
+		std::span<T> span()
+		{
+			checkSpan<T>();
+			return std::span<T>(static_cast<T*>(data()), mSize / sizeof(T));
+		}
+
+		template<typename T>
+			requires std::is_trivially_copyable_v<T>
+		std::span<const T> span() const
+		{
+			checkSpan<T>();
+			return std::span<const T>(static_cast<const T*>(data()), mSize / sizeof(T));
+		}
+
+		/**
+		 * @brief
+		 *  The parent data of the view.
+		 */
+		const shared_data_t& parent() const noexcept
+		{
+			return mData;
+		}
+
+		metadata_t* metadata()
+			requires (!std::same_as<void, metadata_t>)
+		{
+			return mData.metadata();
+		}
+
+		const metadata_t* metadata() const
+			requires (!std::same_as<void, metadata_t>)
+		{
+			return mData.metadata();
+		}
+
+		void makeNull()
+		{
+			mData.makeNull();
+			mOffset = 0;
+			mSize = 0;
+		}
+
+		bool isNull() const
+		{
+			return mData.isNull();
+		}
+
+		operator bool() const
+		{
+			return !mData.isNull();
+		}
+
+	private:
+		template<typename T>
+		void checkSpan() const
+		{
+			if ( 0 != reinterpret_cast<uintptr_t>(data()) % alignof(T) )
+				throw invalid_operation("The view is not aligned for the requested type.");
+
+			if ( 0 != mSize % sizeof(T) )
+				throw invalid_operation("The view size is not a multiple of the requested type size.");
+		}
+
+		size_t mOffset = 0;
+		size_t mSize = 0;
+		shared_data_t mData;
+	};
 }
 
 #endif // !_STD_EXT_MEMORY_SHARED_DATA_H_
\ No newline at end of file
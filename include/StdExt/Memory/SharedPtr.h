@@ -3,41 +3,78 @@
 
 #include "../Concepts.h"
 
+#include "Alignment.h"
 #include "Casting.h"
+#include "RefCount.h"
 
-#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
 
 namespace StdExt
 {
 	namespace Detail
 	{
+		/**
+		 * @internal
+		 * @brief
+		 *  Reference counts shared by the SharedPtr and WeakPtr objects of a managed object.
+		 *
+		 * @details
+		 *  weakCount holds one reference for all of the strong references together, so the
+		 *  block is freed once the object has been destroyed and the last WeakPtr is gone.
+		 *  The object is destroyed through a function pointer to code for its actual type,
+		 *  so neither the block nor the object needs a vtable.
+		 */
+		template<ReferenceCounter ref_count_t>
 		struct SharedPtrControlBase
 		{
-			mutable std::atomic<int> refCount = 1;
+			mutable ref_count_t refCount;
+			mutable ref_count_t weakCount;
 			void* obj_ptr = nullptr;
+			void (*destroy)(void*) = nullptr;
 
-			virtual ~SharedPtrControlBase() = default;
-		};
-
-		template<typename T>
-		struct SharedPtrControl : public SharedPtrControlBase
-		{
-			T obj;
+			void releaseStrong()
+			{
+				if ( refCount.decrement() )
+				{
+					destroy(obj_ptr);
+					releaseWeak();
+				}
+			}
 
-			template<typename ...args_t>
-			SharedPtrControl(args_t ...arguments)
-				: obj(std::forward<args_t>(arguments)...)
+			void releaseWeak()
 			{
-				obj_ptr = &obj;
+				if ( weakCount.decrement() )
+				{
+					std::destroy_at(this);
+					free_aligned(this);
+				}
 			}
+		};
 
-			virtual ~SharedPtrControl() = default;
+		/**
+		 * @internal
+		 * @brief
+		 *  The control block and storage of an object created by makeShared(), which are
+		 *  a single allocation.
+		 */
+		template<typename T, ReferenceCounter ref_count_t>
+		struct SharedPtrControl : public SharedPtrControlBase<ref_count_t>
+		{
+			alignas(T) std::byte storage[sizeof(T)];
 		};
 	}
 
-	template<StrippedType T>
+	template<StrippedType T, ReferenceCounter ref_count_t = AtomicRefCount>
 	class SharedPtr;
 
+	template<StrippedType T, ReferenceCounter ref_count_t = AtomicRefCount>
+	class WeakPtr;
+
+	template<StrippedType T, ReferenceCounter ref_count_t = AtomicRefCount, typename ...args_t>
+	SharedPtr<T, ref_count_t> makeShared(args_t&& ...arguments);
+
 	/**
 	 * @brief
 	 *  SharedPointer type that takes the same local space as a regular
@@ -46,37 +83,50 @@ namespace StdExt
 	 *  Pros:
 	 *   - Pointer object is the size of a single pointer.
 	 *   - Managed object and control structure are always a single allocation.
+	 *   - Neither the control structure nor the managed object needs a vtable.
+	 *
+	 *  WeakPtr objects can reference the object without keeping it alive.  The object is
+	 *  destroyed with the last SharedPtr, but its allocation is only freed once the last
+	 *  WeakPtr is also released.
 	 *
 	 * @note
 	 *  The SharedPtr<T> object itself is not thread safe, but the object it manages
 	 *  maintains its thread safety charateristics.  Different SharedPtr<T> objects
-	 *  referencing the same control structure reference count in a thread safe way.
+	 *  referencing the same control structure reference count in a thread safe way,
+	 *  unless <i>ref_count_t</i> is LocalRefCount, in which case all references to
+	 *  an object must be used from a single thread.
 	 */
-	template<StrippedType T>
+	template<StrippedType T, ReferenceCounter ref_count_t>
 	class SharedPtr final
 	{
-		template<StrippedType U>
+		template<StrippedType U, ReferenceCounter other_ref_count_t>
 		friend class SharedPtr;
 
+		template<StrippedType U, ReferenceCounter other_ref_count_t>
+		friend class WeakPtr;
+
+		template<StrippedType U, ReferenceCounter other_ref_count_t, typename ...args_t>
+		friend SharedPtr<U, other_ref_count_t> makeShared(args_t&& ...arguments);
+
 	private:
-		Detail::SharedPtrControlBase* mControlBlock;
+		Detail::SharedPtrControlBase<ref_count_t>* mControlBlock;
 
 		void incrementBlock() const
 		{
 			if (mControlBlock)
-				++mControlBlock->refCount;
+				mControlBlock->refCount.increment();
 		}
 
 		void decrementBlock()
 		{
-			if (nullptr != mControlBlock && 0 == --mControlBlock->refCount)
-				delete mControlBlock;
+			if (nullptr != mControlBlock)
+				mControlBlock->releaseStrong();
 
 			mControlBlock = nullptr;
 		}
 
 		template<typename U>
-		inline void checkCast(const SharedPtr<U>& other)
+		inline void checkCast(const SharedPtr<U, ref_count_t>& other)
 		{
 			static_assert(
 				SubclassOf<U, T> || (InHierarchyOf<T, U> && Polymorphic<T>) || Is<T, U>,
@@ -101,8 +151,20 @@ namespace StdExt
 		{
 		}
 
+		SharedPtr(const SharedPtr& other)
+		{
+			other.incrementBlock();
+			mControlBlock = other.mControlBlock;
+		}
+
+		SharedPtr(SharedPtr&& other) noexcept
+		{
+			mControlBlock = other.mControlBlock;
+			other.mControlBlock = nullptr;
+		}
+
 		template<typename U>
-		SharedPtr(SharedPtr<U>&& other)
+		SharedPtr(SharedPtr<U, ref_count_t>&& other)
 		{
 			checkCast(other);
 
@@ -111,7 +173,7 @@ namespace StdExt
 		}
 
 		template<typename U>
-		SharedPtr(const SharedPtr<U>& other)
+		SharedPtr(const SharedPtr<U, ref_count_t>& other)
 		{
 			checkCast(other);
 
@@ -124,8 +186,31 @@ namespace StdExt
 			decrementBlock();
 		}
 
+		SharedPtr& operator=(const SharedPtr& other)
+		{
+			other.incrementBlock();
+			decrementBlock();
+
+			mControlBlock = other.mControlBlock;
+
+			return *this;
+		}
+
+		SharedPtr& operator=(SharedPtr&& other) noexcept
+		{
+			if (this != &other)
+			{
+				decrementBlock();
+
+				mControlBlock = other.mControlBlock;
+				other.mControlBlock = nullptr;
+			}
+
+			return *this;
+		}
+
 		template<typename U>
-		SharedPtr& operator=(SharedPtr<U>&& other)
+		SharedPtr& operator=(SharedPtr<U, ref_count_t>&& other)
 		{
 			checkCast(other);
 			decrementBlock();
@@ -137,7 +222,7 @@ namespace StdExt
 		}
 
 		template<typename U>
-		SharedPtr& operator=(const SharedPtr<U>& other)
+		SharedPtr& operator=(const SharedPtr<U, ref_count_t>& other)
 		{
 			checkCast(other);
 			decrementBlock();
@@ -198,15 +283,187 @@ namespace StdExt
 			decrementBlock();
 		}
 
+		/**
+		 * @brief
+		 *  The number of SharedPtr objects that reference the managed object, or zero
+		 *  if this is null.
+		 */
+		int useCount() const
+		{
+			return (mControlBlock) ? mControlBlock->refCount.count() : 0;
+		}
+
 		template<typename ...args_t>
 		static SharedPtr make(args_t ...arguments)
 		{
-			SharedPtr ret;
-			ret.mControlBlock = new Detail::SharedPtrControl<T>(std::forward<args_t>(arguments)...);
+			return makeShared<T, ref_count_t>(std::forward<args_t>(arguments)...);
+		}
+	};
+
+	/**
+	 * @brief
+	 *  A non-owning reference to an object managed by SharedPtr.  lock() gets a SharedPtr
+	 *  to the object if it still exists, so caches can hold references that never dangle
+	 *  and do not keep their objects alive.
+	 *
+	 * @note
+	 *  Like SharedPtr, a WeakPtr object itself is not thread safe.  With AtomicRefCount,
+	 *  lock() can safely race with the release of the last SharedPtr on other threads,
+	 *  and does not take any locks.
+	 */
+	template<StrippedType T, ReferenceCounter ref_count_t>
+	class WeakPtr final
+	{
+		template<StrippedType U, ReferenceCounter other_ref_count_t>
+		friend class WeakPtr;
+
+	private:
+		Detail::SharedPtrControlBase<ref_count_t>* mControlBlock = nullptr;
+
+		void acquire(Detail::SharedPtrControlBase<ref_count_t>* block)
+		{
+			if (block)
+				block->weakCount.increment();
+
+			mControlBlock = block;
+		}
+
+		void release()
+		{
+			if (nullptr != mControlBlock)
+				mControlBlock->releaseWeak();
+
+			mControlBlock = nullptr;
+		}
+
+	public:
+		WeakPtr() = default;
+
+		template<typename U>
+			requires SubclassOf<U, T> || Is<U, T>
+		WeakPtr(const SharedPtr<U, ref_count_t>& ptr)
+		{
+			acquire(ptr.mControlBlock);
+		}
+
+		WeakPtr(const WeakPtr& other)
+		{
+			acquire(other.mControlBlock);
+		}
+
+		WeakPtr(WeakPtr&& other) noexcept
+		{
+			mControlBlock = other.mControlBlock;
+			other.mControlBlock = nullptr;
+		}
+
+		~WeakPtr()
+		{
+			release();
+		}
+
+		WeakPtr& operator=(const WeakPtr& other)
+		{
+			if (other.mControlBlock != mControlBlock)
+			{
+				release();
+				acquire(other.mControlBlock);
+			}
+
+			return *this;
+		}
+
+		WeakPtr& operator=(WeakPtr&& other) noexcept
+		{
+			if (this != &other)
+			{
+				release();
+
+				mControlBlock = other.mControlBlock;
+				other.mControlBlock = nullptr;
+			}
+
+			return *this;
+		}
+
+		template<typename U>
+			requires SubclassOf<U, T> || Is<U, T>
+		WeakPtr& operator=(const SharedPtr<U, ref_count_t>& ptr)
+		{
+			if (ptr.mControlBlock != mControlBlock)
+			{
+				release();
+				acquire(ptr.mControlBlock);
+			}
+
+			return *this;
+		}
+
+		/**
+		 * @brief
+		 *  Returns a SharedPtr to the object, or a null SharedPtr if it has been destroyed
+		 *  or this is null.
+		 */
+		SharedPtr<T, ref_count_t> lock() const
+		{
+			SharedPtr<T, ref_count_t> ret;
+
+			if (nullptr != mControlBlock && mControlBlock->refCount.tryIncrement())
+				ret.mControlBlock = mControlBlock;
 
 			return ret;
 		}
+
+		/**
+		 * @brief
+		 *  Returns true if there is no object to lock(), either because it has been
+		 *  destroyed or because this is null.
+		 */
+		bool expired() const
+		{
+			return (nullptr == mControlBlock || 0 == mControlBlock->refCount.count());
+		}
+
+		void clear()
+		{
+			release();
+		}
 	};
+
+	/**
+	 * @brief
+	 *  Creates an object managed by SharedPtr, constructing it in the same aligned
+	 *  allocation as its control block.
+	 */
+	template<StrippedType T, ReferenceCounter ref_count_t, typename ...args_t>
+	SharedPtr<T, ref_count_t> makeShared(args_t&& ...arguments)
+	{
+		using control_t = Detail::SharedPtrControl<T, ref_count_t>;
+
+		void* allocation = alloc_aligned(sizeof(control_t), alignof(control_t));
+		control_t* block = new (allocation) control_t;
+
+		try
+		{
+			block->obj_ptr = new (block->storage) T(std::forward<args_t>(arguments)...);
+		}
+		catch (...)
+		{
+			std::destroy_at(block);
+			free_aligned(allocation);
+			throw;
+		}
+
+		block->destroy = [](void* obj)
+		{
+			std::destroy_at(static_cast<T*>(obj));
+		};
+
+		SharedPtr<T, ref_count_t> ret;
+		ret.mControlBlock = block;
+
+		return ret;
+	}
 }
 
 #endif // !_STD_EXT_MEMORY_SHARED_PTR_H_
\ No newline at end of file
@@ -96,9 +96,9 @@ namespace StdExt
 	 *  avoid a memory leak.
 	 */
 	template<typename T>
-	T* allocate_n(size_t amount)
+	T* allocate_n(size_t amount, const std::source_location& location = std::source_location::current())
 	{
-		return reinterpret_cast<T*>(alloc_aligned(sizeof(T) * amount, alignof(T)));
+		return reinterpret_cast<T*>(alloc_aligned(sizeof(T) * amount, alignof(T), location));
 	}
 
 	/**
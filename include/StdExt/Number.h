@@ -10,7 +10,9 @@
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <stdexcept>
+#include <string_view>
 #include <type_traits>
 #include <variant>
 
@@ -373,8 +375,32 @@ namespace StdExt
 		/**
 		 * @brief
 		 *  Parses the string into a number.
+		 *
+		 * @details
+		 *  Parsing is a single locale-independent pass.  Surrounding whitespace is
+		 *  ignored.  Integers are stored as uint64_t, or int64_t when negative, unless
+		 *  they are outside the range of those types.  Text with a fraction, exponent,
+		 *  infinity, or NaN is stored as float64_t.
+		 *
+		 * @throws std::invalid_argument
+		 *  If the text is not a number.
+		 *
+		 * @throws std::out_of_range
+		 *  If the number is outside the range of float64_t.
 		 */
 		static Number parse(const String& str);
+		static Number parse(std::u8string_view str);
+		static Number parse(const char8_t* str);
+
+		/**
+		 * @brief
+		 *  Parses each of <i>strings</i> into the corresponding element of <i>out</i>.
+		 *
+		 * @throws std::invalid_argument
+		 *  If <i>strings</i> and <i>out</i> are not the same size, or any of the text
+		 *  is not a number.
+		 */
+		static void parse(std::span<const std::u8string_view> strings, std::span<Number> out);
 
 		/**
 		 * @brief
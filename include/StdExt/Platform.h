@@ -13,6 +13,10 @@
 #	define STD_EXT_GCC
 #endif
 
+#if defined(__linux__)
+#	define STD_EXT_LINUX
+#endif
+
 #if !defined(STD_EXT_DEBUG)
 #	if defined(_MSC_VER) && defined(_DEBUG)
 #		define STD_EXT_DEBUG
@@ -37,6 +41,18 @@
 #	endif
 #endif
 
+#if !defined(STD_EXT_NO_SIMD)
+#	if defined(__AVX2__)
+#		define STD_EXT_AVX2
+#	endif
+#	if defined(__SSE4_2__) || defined(STD_EXT_AVX2)
+#		define STD_EXT_SSE4_2
+#	endif
+#	if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(STD_EXT_SSE4_2)
+#		define STD_EXT_SSE2
+#	endif
+#endif
+
 namespace StdExt
 {
 	namespace Platform
@@ -80,6 +96,60 @@ namespace StdExt
 		#else
 			static constexpr bool RTTI = false;
 		#endif
+
+		#if defined(STD_EXT_SSE2)
+			static constexpr bool SSE2 = true;
+		#else
+			static constexpr bool SSE2 = false;
+		#endif
+
+		#if defined(STD_EXT_SSE4_2)
+			static constexpr bool SSE4_2 = true;
+		#else
+			static constexpr bool SSE4_2 = false;
+		#endif
+
+		#if defined(STD_EXT_AVX2)
+			static constexpr bool AVX2 = true;
+		#else
+			static constexpr bool AVX2 = false;
+		#endif
+
+		/**
+		 * @brief
+		 *  Defining STD_EXT_CACHE_STRING_HASH stores the hashes of heap allocated strings
+		 *  with their shared memory, at the cost of 8 bytes per SharedArray allocation.
+		 */
+		#if defined(STD_EXT_CACHE_STRING_HASH)
+			static constexpr bool CacheStringHash = true;
+		#else
+			static constexpr bool CacheStringHash = false;
+		#endif
+
+		/**
+		 * @brief
+		 *  Defining STD_EXT_POOLED_ALLOC when building the library serves small allocations
+		 *  of alloc_aligned() from size classes with per-thread free lists, at the cost of
+		 *  a 16 byte header per allocation.  See alloc_pool_stats().
+		 */
+		#if defined(STD_EXT_POOLED_ALLOC)
+			static constexpr bool PooledAlloc = true;
+		#else
+			static constexpr bool PooledAlloc = false;
+		#endif
+
+		/**
+		 * @brief
+		 *  Defining STD_EXT_TRACK_ALLOC when building the library records counts, sizes and
+		 *  call sites of allocations made through alloc_aligned() and related functions,
+		 *  at the cost of a header per allocation and counter updates on each call.  See
+		 *  alloc_tracking_stats().
+		 */
+		#if defined(STD_EXT_TRACK_ALLOC)
+			static constexpr bool TrackAlloc = true;
+		#else
+			static constexpr bool TrackAlloc = false;
+		#endif
 	}
 }
 
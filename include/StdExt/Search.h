@@ -0,0 +1,54 @@
+#ifndef _STD_EXT_SEARCH_H_
+#define _STD_EXT_SEARCH_H_
+
+#include "StdExt.h"
+#include "Concepts.h"
+
+#include <string_view>
+
+/**
+ * @brief
+ *  Character search primitives used by StringBase.
+ *
+ * @details
+ *  These have the same semantics as the corresponding std::basic_string_view
+ *  member functions, but are implemented with SSE2, SSE4.2, or AVX2 instructions
+ *  when the library is built for targets that support them, falling back to scalar
+ *  code otherwise.
+ */
+namespace StdExt::Search
+{
+	/**
+	 * @brief
+	 *  Returns the index of the first occurrence of <i>ch</i> in <i>str</i> at or after
+	 *  <i>pos</i>, or npos if it is not found.
+	 */
+	template<Character char_t>
+	STD_EXT_EXPORT size_t find(std::basic_string_view<char_t> str, char_t ch, size_t pos = 0) noexcept;
+
+	/**
+	 * @brief
+	 *  Returns the index of the first occurrence of <i>substr</i> in <i>str</i> at or after
+	 *  <i>pos</i>, or npos if it is not found.
+	 */
+	template<Character char_t>
+	STD_EXT_EXPORT size_t find(
+		std::basic_string_view<char_t> str,
+		std::basic_string_view<char_t> substr,
+		size_t pos = 0
+	) noexcept;
+
+	/**
+	 * @brief
+	 *  Returns the index of the first character in <i>str</i> at or after <i>pos</i> that
+	 *  is also in <i>set</i>, or npos if there are none.
+	 */
+	template<Character char_t>
+	STD_EXT_EXPORT size_t findFirstOf(
+		std::basic_string_view<char_t> str,
+		std::basic_string_view<char_t> set,
+		size_t pos = 0
+	) noexcept;
+}
+
+#endif // !_STD_EXT_SEARCH_H_
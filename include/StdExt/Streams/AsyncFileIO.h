@@ -0,0 +1,192 @@
+#ifndef _STD_EXT_STREAMS_ASYNC_FILE_IO_H_
+#define _STD_EXT_STREAMS_ASYNC_FILE_IO_H_
+
+#include "FdFileStream.h"
+
+#include "../Buffer.h"
+#include "../Memory/SharedData.h"
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace StdExt::Streams
+{
+	namespace Detail
+	{
+		struct AsyncRequest;
+		class AsyncEngine;
+	}
+
+	/**
+	 * @brief
+	 *  Performs reads and writes of FdFileStream regions in the background, reporting
+	 *  completion through futures or callbacks.
+	 *
+	 * @details
+	 *  On Linux, requests are queued to the kernel through io_uring.  Where io_uring is
+	 *  not available, either because of the platform or because the kernel or a sandbox
+	 *  refuses it, a small pool of worker threads performs positional reads and writes
+	 *  instead.  backend() reports which one is in use.
+	 *
+	 *  At most queueDepth() requests are in flight at once.  Submitting more blocks
+	 *  until earlier requests complete.  A Batch groups requests so they are handed to
+	 *  the backend together, which on io_uring is a single system call.
+	 *
+	 *  Requests never use or move the seek position of the file.  Reads stop early
+	 *  only at the end of the file, so the completed byte count is the number of bytes
+	 *  requested unless the read reached it.  Writes past the end of the file grow it,
+	 *  and FdFileStream::size() reflects the write once it has completed.
+	 *
+	 *  Memory passed as a Buffer must stay valid, and the file must stay open, until
+	 *  the request completes.  SharedDataView arguments are referenced by the request
+	 *  until it completes, so they may be released by the caller at once.
+	 *
+	 *  Callbacks are run on a thread owned by the engine, and must not block for long
+	 *  or throw.  They must not submit requests either, since waiting for a free slot in
+	 *  the queue would block the thread that frees them.  The destructor waits for all
+	 *  requests in flight to complete.
+	 */
+	class STD_EXT_EXPORT AsyncFileIO
+	{
+	public:
+
+		/**
+		 * @brief
+		 *  The mechanism performing requests.
+		 */
+		enum class Backend
+		{
+			/**
+			 * @brief
+			 *  Use io_uring when available, and the thread pool otherwise.
+			 */
+			Auto,
+
+			/**
+			 * @brief
+			 *  Linux io_uring, with requests completed by the kernel.
+			 */
+			IoUring,
+
+			/**
+			 * @brief
+			 *  Worker threads performing blocking positional reads and writes.
+			 */
+			ThreadPool
+		};
+
+		/**
+		 * @brief
+		 *  Called with the number of bytes transferred when a request succeeds, or with
+		 *  the exception describing its failure.
+		 */
+		using Completion = std::function<void(size_t bytes, std::exception_ptr error)>;
+
+		/**
+		 * @brief
+		 *  Collects requests and submits them to the engine together when submit() is
+		 *  called or the batch is destroyed.
+		 *
+		 * @details
+		 *  Requests are validated when they are added, so invalid requests throw before
+		 *  anything is submitted.  Nothing is started until the batch is submitted, so
+		 *  futures of a batch must not be waited on before then.
+		 */
+		class STD_EXT_EXPORT Batch
+		{
+		public:
+			Batch(AsyncFileIO& engine);
+			Batch(const Batch&) = delete;
+			Batch& operator=(const Batch&) = delete;
+
+			/**
+			 * @brief
+			 *  Submits any requests that have not been submitted.
+			 */
+			~Batch();
+
+			std::future<size_t> read(FdFileStream& file, uint64_t offset, Buffer& destination);
+			std::future<size_t> read(FdFileStream& file, uint64_t offset, SharedDataView<> destination);
+
+			std::future<size_t> write(FdFileStream& file, uint64_t offset, const Buffer& data);
+			std::future<size_t> write(FdFileStream& file, uint64_t offset, SharedDataView<> data);
+
+			void read(FdFileStream& file, uint64_t offset, SharedDataView<> destination, Completion callback);
+			void write(FdFileStream& file, uint64_t offset, SharedDataView<> data, Completion callback);
+
+			/**
+			 * @brief
+			 *  The number of requests waiting to be submitted.
+			 */
+			size_t size() const;
+
+			/**
+			 * @brief
+			 *  Hands all requests collected so far to the engine.
+			 */
+			void submit();
+
+		private:
+			Detail::AsyncEngine* mEngine;
+			std::vector<Detail::AsyncRequest*> mRequests;
+		};
+
+		/**
+		 * @param queueDepth
+		 *  The maximum number of requests in flight at once.  io_uring limits this to
+		 *  4096, and queueDepth() reports the limit in use.
+		 *
+		 * @param backend
+		 *  The backend to use.  Requesting IoUring where it is not available throws
+		 *  not_supported.
+		 */
+		AsyncFileIO(size_t queueDepth = 64, Backend backend = Backend::Auto);
+
+		AsyncFileIO(const AsyncFileIO&) = delete;
+		AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+
+		/**
+		 * @brief
+		 *  Waits for all requests in flight to complete.
+		 */
+		~AsyncFileIO();
+
+		/**
+		 * @brief
+		 *  The backend in use, which is never Auto.
+		 */
+		Backend backend() const;
+
+		size_t queueDepth() const;
+
+		/**
+		 * @brief
+		 *  Whether io_uring can be used on this system.
+		 */
+		static bool ioUringAvailable();
+
+		std::future<size_t> read(FdFileStream& file, uint64_t offset, Buffer& destination);
+		std::future<size_t> read(FdFileStream& file, uint64_t offset, SharedDataView<> destination);
+
+		std::future<size_t> write(FdFileStream& file, uint64_t offset, const Buffer& data);
+		std::future<size_t> write(FdFileStream& file, uint64_t offset, SharedDataView<> data);
+
+		void read(FdFileStream& file, uint64_t offset, SharedDataView<> destination, Completion callback);
+		void write(FdFileStream& file, uint64_t offset, SharedDataView<> data, Completion callback);
+
+		/**
+		 * @brief
+		 *  Blocks until no requests are in flight.
+		 */
+		void drain();
+
+	private:
+		std::unique_ptr<Detail::AsyncEngine> mEngine;
+	};
+}
+
+#endif // !_STD_EXT_STREAMS_ASYNC_FILE_IO_H_
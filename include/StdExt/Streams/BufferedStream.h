@@ -5,12 +5,19 @@
 
 #include "../Buffer.h"
 
+#include <cstddef>
+#include <span>
+
 namespace StdExt::Streams
 {
 	/**
 	 * @brief
 	 *  Stream with a dynamically allocated buffer that will grow
 	 *  to fit the max size of the contents that are written to it.
+	 *
+	 * @details
+	 *  The buffer at least doubles in capacity when it grows, so a long series of small
+	 *  writes is amortized to a constant cost per byte.
 	 */
 	class STD_EXT_EXPORT BufferedStream : public ByteStream
 	{
@@ -21,6 +28,8 @@ namespace StdExt::Streams
 		void* dataPtr(size_t seekPos) const override;
 		void readRaw(void* destination, size_t byteLength) override;
 		void writeRaw(const void* data, size_t byteLength) override;
+		void readVec(std::span<const MutableBuffer> buffers) override;
+		void writeVec(std::span<const ConstBuffer> buffers) override;
 		void seek(size_t position) override;
 		size_t getSeekPosition() const override;
 		size_t bytesAvailable() const override;
@@ -36,7 +45,41 @@ namespace StdExt::Streams
 		 */
 		void* expandForWrite(size_t byteLength);
 
+		/**
+		 * @brief
+		 *  Expands the internal buffer for direct writing of <i>byteLength</i> bytes at the
+		 *  seek position, and moves the seek position past them.  The returned span is
+		 *  valid until the next operation that can grow or release the buffer.
+		 */
+		std::span<std::byte> writeSpan(size_t byteLength);
+
+		/**
+		 * @brief
+		 *  Grows the internal buffer to hold at least <i>capacity</i> bytes, so writes up
+		 *  to that size do not reallocate.
+		 */
+		void reserve(size_t capacity);
+
+		/**
+		 * @brief
+		 *  The number of bytes the internal buffer can hold before it has to grow.
+		 */
+		size_t capacity() const;
+
+		/**
+		 * @brief
+		 *  Hands the internal buffer, trimmed to the bytes written, to the caller and
+		 *  leaves the stream empty.
+		 *
+		 * @details
+		 *  The data is not copied.  Trimming returns unused capacity to the allocator,
+		 *  which for large buffers on Linux releases pages in place.
+		 */
+		StdExt::Buffer release();
+
 	private:
+		void growFor(size_t end);
+
 		StdExt::Buffer mBuffer;
 		size_t mBytesWritten;
 		size_t mSeekPosition;
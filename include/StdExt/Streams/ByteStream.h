@@ -6,12 +6,33 @@
 #include <cstdint>
 #include <exception>
 #include <limits>
+#include <span>
 #include <string>
 #include <tuple>
 #include <type_traits>
 
 namespace StdExt::Streams
 {
+	/**
+	 * @brief
+	 *  A range of bytes to be written, one of several gathered by ByteStream::writeVec().
+	 */
+	struct ConstBuffer
+	{
+		const void* data = nullptr;
+		size_t size = 0;
+	};
+
+	/**
+	 * @brief
+	 *  A range of bytes to be read into, one of several filled by ByteStream::readVec().
+	 */
+	struct MutableBuffer
+	{
+		void* data = nullptr;
+		size_t size = 0;
+	};
+
 	/**
 	 * Base class for all data streams. 
 	 */
@@ -116,6 +137,31 @@ namespace StdExt::Streams
 		 */
 		virtual void writeRaw(const void* data, size_t byteLength);
 
+		/**
+		 * @brief
+		 *  Reads data from the current seek position into each of <i>buffers</i> in turn,
+		 *  as if readRaw() were called for each.  The seek position is moved by the total
+		 *  number of bytes read.
+		 *
+		 * @details
+		 *  The default implementation calls readRaw() for each buffer.  Implementations
+		 *  override this to fill all buffers with a single operation.
+		 */
+		virtual void readVec(std::span<const MutableBuffer> buffers);
+
+		/**
+		 * @brief
+		 *  Writes the contents of each of <i>buffers</i> in turn, as if writeRaw() were
+		 *  called for each.  The seek position is moved by the total number of bytes
+		 *  written.
+		 *
+		 * @details
+		 *  The default implementation calls writeRaw() for each buffer.  Implementations
+		 *  override this to write all buffers with a single operation, so a header and
+		 *  its payload can be written without a copy into a temporary buffer.
+		 */
+		virtual void writeVec(std::span<const ConstBuffer> buffers);
+
 		/**
 		 * @brief
 		 *  Seeks to the position in terms of number of bytes from the beginning.
@@ -174,6 +220,18 @@ namespace StdExt::Streams
 	protected:
 		void setFlags(uint32_t mask);
 
+		/**
+		 * @brief
+		 *  The total number of bytes in <i>buffers</i>.
+		 */
+		static size_t totalSize(std::span<const ConstBuffer> buffers);
+
+		/**
+		 * @brief
+		 *  The total number of bytes in <i>buffers</i>.
+		 */
+		static size_t totalSize(std::span<const MutableBuffer> buffers);
+
 	private:
 		uint32_t mFlags;
 	};
@@ -0,0 +1,181 @@
+#ifndef _STD_EXT_STREAMS_FD_FILE_STREAM_H_
+#define _STD_EXT_STREAMS_FD_FILE_STREAM_H_
+
+#include "ByteStream.h"
+
+#include "../String.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace StdExt::Streams
+{
+	namespace Detail
+	{
+		class AsyncEngine;
+	}
+
+	/**
+	 * @brief
+	 *  File based ByteStream that uses positional reads and writes on a native file
+	 *  descriptor, with 64-bit offsets.
+	 *
+	 * @details
+	 *  Unlike FileStream, the seek position is kept by the stream instead of the file,
+	 *  and the size of the file is cached when it is opened and updated by writes, so
+	 *  bytesAvailable() and canRead() do not touch the file.  canWrite() reports whether
+	 *  a write fits within the current size of the file, and with autoExpand grows the
+	 *  file to fit it.
+	 *
+	 *  readAt() and writeAt() do not use or move the seek position, and can be called
+	 *  from multiple threads at once to access distinct regions of the same file.  The
+	 *  ByteStream interface that does use the seek position is not thread safe.
+	 *
+	 *  Files opened for writing are created if they don't exist, and are readable.
+	 *  On POSIX systems, errors from the file system are thrown as std::system_error
+	 *  carrying errno, so callers can recognize file systems that reject direct I/O or
+	 *  large offsets.
+	 */
+	class STD_EXT_EXPORT FdFileStream : public ByteStream
+	{
+	public:
+
+		/**
+		 * @brief
+		 *  Options that change how the file is opened.
+		 */
+		enum Options : uint32_t
+		{
+			/**
+			 * @brief
+			 *  No special handling.
+			 */
+			NO_OPTIONS = 0,
+
+			/**
+			 * @brief
+			 *  Bypass the operating system's page cache.  Buffers, file offsets and
+			 *  lengths of every read and write must be multiples of DirectAlignment,
+			 *  otherwise std::invalid_argument is thrown.  Uses O_DIRECT on Linux,
+			 *  F_NOCACHE on Apple platforms, and FILE_FLAG_NO_BUFFERING on Windows.
+			 */
+			DIRECT_IO = 1
+		};
+
+		/**
+		 * @brief
+		 *  Required alignment of buffers, offsets and lengths of I/O on streams opened
+		 *  with DIRECT_IO.  This covers the logical block size of common devices.
+		 */
+		static constexpr size_t DirectAlignment = 4096;
+
+		FdFileStream(const FdFileStream&) = delete;
+		FdFileStream& operator=(const FdFileStream&) = delete;
+
+		FdFileStream();
+
+		/**
+		 * @param path
+		 *    Either an absolute or relative path to the file.
+		 *
+		 * @param readonly
+		 *    Designates whether the file will only be opened for reading.
+		 *
+		 * @param options
+		 *    Bitwise combination of Options.
+		 */
+		FdFileStream(const String& path, bool readonly, uint32_t options = NO_OPTIONS);
+
+		/**
+		 * Move constructor.  The entire state of other, including the seek position,
+		 * will be moved to the new object.
+		 */
+		FdFileStream(FdFileStream&& other) noexcept;
+
+		virtual ~FdFileStream();
+
+		FdFileStream& operator=(FdFileStream&& other) noexcept;
+
+		virtual void readRaw(void* destination, size_t byteLength) override;
+		virtual void writeRaw(const void* data, size_t byteLength) override;
+		virtual void readVec(std::span<const MutableBuffer> buffers) override;
+		virtual void writeVec(std::span<const ConstBuffer> buffers) override;
+		virtual void seek(size_t position) override;
+		virtual size_t getSeekPosition() const override;
+		virtual size_t bytesAvailable() const override;
+		virtual bool canRead(size_t numBytes) override;
+		virtual bool canWrite(size_t numBytes, bool autoExpand = false) override;
+		virtual void clear() override;
+
+		/**
+		 * @brief
+		 *  Opens the file, throwing a std::runtime_error if it cannot be opened.  Returns
+		 *  false if the stream already has a file open.
+		 */
+		bool open(const String& path, bool readonly, uint32_t options = NO_OPTIONS);
+
+		void close();
+
+		bool isOpen() const;
+
+		/**
+		 * @brief
+		 *  Reads up to <i>byteLength</i> bytes starting at <i>offset</i> without using
+		 *  the seek position, returning the number of bytes read.  Fewer bytes are read
+		 *  only when the end of the file is reached.
+		 */
+		size_t readAt(uint64_t offset, void* destination, size_t byteLength) const;
+
+		/**
+		 * @brief
+		 *  Writes <i>byteLength</i> bytes starting at <i>offset</i> without using the
+		 *  seek position, growing the file if the write ends past its current size.
+		 */
+		void writeAt(uint64_t offset, const void* data, size_t byteLength);
+
+		/**
+		 * @brief
+		 *  The cached size of the file.
+		 */
+		uint64_t size() const;
+
+		/**
+		 * @brief
+		 *  Truncates or extends the file to <i>newSize</i> bytes.  This is needed to
+		 *  trim files written with DIRECT_IO to a size that is not a multiple of
+		 *  DirectAlignment.
+		 */
+		void resize(uint64_t newSize);
+
+		/**
+		 * @brief
+		 *  Writes data buffered by the operating system to the device and waits for
+		 *  completion.
+		 */
+		void flush();
+
+		/**
+		 * @brief
+		 *  The file descriptor, or HANDLE on Windows, of the open file.
+		 */
+		intptr_t nativeHandle() const;
+
+	private:
+		friend class Detail::AsyncEngine;
+
+		void checkDirectIO(uint64_t offset, const void* buffer, size_t byteLength) const;
+		void extendSize(uint64_t end);
+
+	#if defined(STD_EXT_WIN32)
+		void* mFile;
+	#else
+		int mFile;
+	#endif
+
+		uint32_t mOptions;
+		uint64_t mSeekPosition;
+		std::atomic<uint64_t> mSize;
+	};
+}
+
+#endif // !_STD_EXT_STREAMS_FD_FILE_STREAM_H_
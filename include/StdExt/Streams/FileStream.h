@@ -43,6 +43,8 @@ namespace StdExt::Streams
 
 		virtual void readRaw(void* destination, size_t byteLength) override;
 		virtual void writeRaw(const void* data, size_t byteLength) override;
+		virtual void readVec(std::span<const MutableBuffer> buffers) override;
+		virtual void writeVec(std::span<const ConstBuffer> buffers) override;
 		virtual void seek(size_t position) override;
 		virtual size_t getSeekPosition() const override;
 		virtual size_t bytesAvailable() const override;
@@ -0,0 +1,160 @@
+#ifndef _STD_EXT_STREAMS_MAPPED_FILE_STREAM_H_
+#define _STD_EXT_STREAMS_MAPPED_FILE_STREAM_H_
+
+#include "ByteStream.h"
+
+#include "../String.h"
+
+namespace StdExt::Streams
+{
+	/**
+	 * @brief
+	 *  File based ByteStream that maps the file into memory, so reads and writes are
+	 *  copies to and from the mapping and dataPtr() gives direct access to file contents.
+	 *
+	 * @details
+	 *  Files opened for writing are created if they don't exist, and are readable.
+	 *  Writes past the end of the file grow it.  The mapping grows geometrically, so the
+	 *  file on disk can be larger than the data written until the stream is closed, at
+	 *  which point it is truncated to the written size.
+	 *
+	 *  Pointers returned by dataPtr() are invalidated when a write grows the mapping,
+	 *  and when the stream is closed.
+	 */
+	class STD_EXT_EXPORT MappedFileStream : public ByteStream
+	{
+	public:
+
+		/**
+		 * @brief
+		 *  Expected pattern of access to the mapping, passed to the operating system to
+		 *  tune read-ahead and caching of pages.
+		 */
+		enum class AccessHint
+		{
+			/**
+			 * @brief
+			 *  No special treatment.
+			 */
+			Normal,
+
+			/**
+			 * @brief
+			 *  Pages will be accessed in order, so read ahead aggressively and pages
+			 *  already read can be dropped soon.
+			 */
+			Sequential,
+
+			/**
+			 * @brief
+			 *  Pages will be accessed in no particular order, so read ahead is wasted.
+			 */
+			Random,
+
+			/**
+			 * @brief
+			 *  The whole file will be needed soon, so start reading it in now.
+			 */
+			WillNeed
+		};
+
+		MappedFileStream(const MappedFileStream&) = delete;
+		MappedFileStream& operator=(const MappedFileStream&) = delete;
+
+		MappedFileStream();
+
+		/**
+		 * @param path
+		 *    Either an absolute or relative path to the file.
+		 *
+		 * @param readonly
+		 *    Designates whether the file will only be opened for reading.
+		 */
+		MappedFileStream(const String& path, bool readonly);
+
+		/**
+		 * Move constructor.  The entire state of other, including the mapping and seek
+		 * position, will be moved to the new object.
+		 */
+		MappedFileStream(MappedFileStream&& other) noexcept;
+
+		virtual ~MappedFileStream();
+
+		MappedFileStream& operator=(MappedFileStream&& other) noexcept;
+
+		virtual void* dataPtr(size_t seekPos) const override;
+
+		virtual void readRaw(void* destination, size_t byteLength) override;
+		virtual void writeRaw(const void* data, size_t byteLength) override;
+		virtual void seek(size_t position) override;
+		virtual size_t getSeekPosition() const override;
+		virtual size_t bytesAvailable() const override;
+		virtual bool canRead(size_t numBytes) override;
+		virtual bool canWrite(size_t numBytes, bool autoExpand = false) override;
+		virtual void clear() override;
+
+		/**
+		 * @brief
+		 *  Opens and maps the file, throwing a std::runtime_error if it cannot be opened
+		 *  or mapped.  Returns false if the stream already has a file open.
+		 */
+		bool open(const String& path, bool readonly);
+
+		/**
+		 * @brief
+		 *  Unmaps and closes the file, truncating it to the size of the data written.
+		 */
+		void close();
+
+		bool isOpen() const;
+
+		/**
+		 * @brief
+		 *  The size of the file's data, which does not include space mapped in advance
+		 *  of writes.
+		 */
+		size_t size() const;
+
+		/**
+		 * @brief
+		 *  Grows the mapping of a writable stream to hold at least <i>capacity</i> bytes,
+		 *  so writes up to that size do not remap the file.
+		 */
+		void reserve(size_t capacity);
+
+		/**
+		 * @brief
+		 *  Passes the expected pattern of access to the operating system.  The hint is
+		 *  kept and reapplied when the mapping grows.  It has no effect on Windows.
+		 */
+		void adviseAccess(AccessHint hint);
+
+		/**
+		 * @brief
+		 *  Writes modified pages of the mapping to the file and waits for completion.
+		 */
+		void flush();
+
+	private:
+		void mapFile(size_t capacity);
+		void unmapFile() noexcept;
+		void remap(size_t capacity);
+		void applyHint();
+
+	#if defined(STD_EXT_WIN32)
+		void* mFile;
+		void* mMapping;
+	#else
+		int mFile;
+	#endif
+
+		std::byte* mData;
+		size_t mSize;
+		size_t mCapacity;
+		size_t mSeekPosition;
+
+		AccessHint mHint;
+	};
+}
+
+#endif // !_STD_EXT_STREAMS_MAPPED_FILE_STREAM_H_
@@ -3,6 +3,8 @@
 
 #include "ByteStream.h"
 
+#include "../Memory/SharedData.h"
+
 namespace StdExt::Streams
 {
 	/**
@@ -29,6 +31,28 @@ namespace StdExt::Streams
 		 */
 		MemoryStream(void* beginning, size_t size, Flags flags = NO_FLAGS);
 
+		/**
+		 * @brief
+		 *  Maps the stream to the bytes of <i>view</i> without copying them.  The stream
+		 *  does not hold a reference to the data, so the view must outlive it.
+		 */
+		template<typename metadata_t, ReferenceCounter ref_count_t>
+		MemoryStream(SharedDataView<metadata_t, ref_count_t>& view, Flags flags = NO_FLAGS)
+			: MemoryStream(view.data(), view.size(), flags)
+		{
+		}
+
+		/**
+		 * @brief
+		 *  Maps a read only stream to the bytes of <i>view</i> without copying them.  The
+		 *  stream does not hold a reference to the data, so the view must outlive it.
+		 */
+		template<typename metadata_t, ReferenceCounter ref_count_t>
+		MemoryStream(const SharedDataView<metadata_t, ref_count_t>& view)
+			: MemoryStream(view.data(), view.size())
+		{
+		}
+
 		virtual ~MemoryStream();
 
 		virtual void* dataPtr(size_t seekPos) const override;
@@ -32,6 +32,10 @@ namespace StdExt::Streams
 
 		virtual void writeRaw(const void* data, size_t byteLength) override;
 
+		virtual void readVec(std::span<const MutableBuffer> buffers) override;
+
+		virtual void writeVec(std::span<const ConstBuffer> buffers) override;
+
 		virtual size_t bytesAvailable() const override;
 
 		virtual bool canRead(size_t numBytes) override;
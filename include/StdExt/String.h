@@ -2,15 +2,21 @@
 #define _STD_EXT_STRING_H_
 
 #include "StdExt.h"
+#include "Buffer.h"
 #include "Concepts.h"
 
 #include "Collections/SharedArray.h"
 #include "Const/String.h"
+#include "Memory/Allocator.h"
 #include "Memory/Utility.h"
 #include "Serialize/Binary/Binary.h"
 #include "Streams/ByteStream.h"
+#include "Hash.h"
+#include "Search.h"
+#include "Unicode.h"
 
 #include <string>
+#include <iterator>
 #include <array>
 #include <span>
 
@@ -37,15 +43,23 @@ namespace StdExt
 	 * @brief
 	 *  %String class that avoids deep copying by sharing data among copies and substrings,
 	 *  and limits its character types to unicode for greater interoperablity.
+	 *
+	 * @tparam small_byte_size
+	 *  The number of bytes of string data stored in the object itself before heap memory
+	 *  is used.  Strings with different small sizes can be constructed from each other,
+	 *  sharing heap and literal data instead of copying it.
 	 */
-	template<Character char_t>
+	template<Character char_t, size_t small_byte_size = 16>
 	class StringBase
 	{
+		template<Character, size_t>
+		friend class StringBase;
+
 	public:
 		using view_t = std::basic_string_view<char_t>;
 		using shared_array_t = Collections::SharedArray<char_t>;
 
-		static constexpr size_t SmallByteSize = 16;
+		static constexpr size_t SmallByteSize = small_byte_size;
 		static_assert(
 			SmallByteSize % 4 == 0 && SmallByteSize > 1,
 			"SmallSize must be a multiple of 4 bytes and greater than 1."
@@ -130,6 +144,66 @@ namespace StdExt
 		}
 		///@}
 
+		/**
+		 * @brief
+		 *  Creates a string that takes ownership of the memory of <i>buffer</i> instead of
+		 *  copying it.  The contents of the buffer, without any trailing zero characters,
+		 *  become the string.  The buffer must be aligned for char_t.
+		 */
+		static StringBase adopt(Buffer&& buffer)
+		{
+			Buffer owned(std::move(buffer));
+
+			assert(0 == reinterpret_cast<uintptr_t>(owned.data()) % alignof(char_t));
+
+			view_t contents = trimEnd(
+				view_t(static_cast<const char_t*>(owned.data()), owned.size() / sizeof(char_t))
+			);
+
+			if (contents.size() <= SmallSize)
+				return StringBase(contents);
+
+			StringBase ret;
+			ret.mHeapReference = shared_array_t::adopt(
+				std::move(owned),
+				[](Buffer& stored)
+				{
+					return std::span<char_t>(
+						static_cast<char_t*>(stored.data()), stored.size() / sizeof(char_t)
+					);
+				}
+			);
+			ret.mView = view_t(ret.mHeapReference.data(), contents.size());
+
+			return ret;
+		}
+
+		/**
+		 * @brief
+		 *  Creates a string of the <i>length</i> characters at <i>str</i> without copying
+		 *  them.  <i>deleter</i> is called with <i>str</i> when the string and all copies
+		 *  and substrings sharing its memory are destroyed.  Strings that fit in small
+		 *  memory are copied, and <i>deleter</i> is called immediately.
+		 */
+		template<typename deleter_t>
+		static StringBase adopt(char_t* str, size_t length, deleter_t deleter)
+		{
+			if (length <= SmallSize)
+			{
+				StringBase ret;
+				ret.copyFrom(view_t(str, length));
+				deleter(str);
+
+				return ret;
+			}
+
+			StringBase ret;
+			ret.mHeapReference = shared_array_t::adopt(str, length, std::move(deleter));
+			ret.mView = view_t(ret.mHeapReference.data(), length);
+
+			return ret;
+		}
+
 		StringBase() noexcept
 		{
 			mSmallMemory[SmallSize] = 0;
@@ -158,6 +232,18 @@ namespace StdExt
 			copyFrom( trimEnd(str) );
 		}
 
+		/**
+		 * @brief
+		 *  Copies <i>str</i> into memory from <i>allocator</i> when it does not fit in
+		 *  small memory.  Appending to the string keeps using <i>allocator</i> while the
+		 *  string is on the heap.
+		 */
+		StringBase(view_t str, Allocator& allocator)
+			: StringBase()
+		{
+			copyFrom( trimEnd(str), &allocator );
+		}
+
 		StringBase(StringBase&& other) noexcept
 			: StringBase()
 		{
@@ -193,6 +279,63 @@ namespace StdExt
 		{
 		}
 
+		/**
+		 * @brief
+		 *  Takes ownership of the memory of <i>str</i> instead of copying it.  Strings
+		 *  that fit in small memory are copied instead.
+		 */
+		StringBase(std::basic_string<char_t>&& str)
+			: StringBase()
+		{
+			size_t length = trimEnd(view_t(str)).size();
+
+			if (length <= SmallSize)
+			{
+				copyFrom(view_t(str.data(), length));
+				return;
+			}
+
+			mHeapReference = shared_array_t::adopt(
+				std::move(str),
+				[](std::basic_string<char_t>& owned)
+				{
+					// Includes the null terminator std::basic_string guarantees.
+					return std::span<char_t>(owned.data(), owned.size() + 1);
+				}
+			);
+
+			mView = view_t(mHeapReference.data(), length);
+		}
+
+		/**
+		 * @brief
+		 *  Creates a string from one with a different small size.  Heap and literal data
+		 *  are shared.  Data is only copied when it fits in the small memory of this
+		 *  string, or when it was in the small memory of <i>other</i> and does not.
+		 */
+		template<size_t other_byte_size>
+			requires (other_byte_size != small_byte_size)
+		StringBase(const StringBase<char_t, other_byte_size>& other)
+			: StringBase()
+		{
+			if ( other.isNull() )
+				return;
+
+			if ( other.size() > SmallSize && (other.isOnHeap() || other.isExternal()) )
+			{
+				mHeapReference = other.mHeapReference;
+				mView = other.mView;
+			}
+			else if ( other.isExternal() )
+			{
+				mView = other.mView;
+			}
+			else
+			{
+				copyFrom(other.mView);
+			}
+		}
+
 		StringBase& operator=(const view_t& other) noexcept
 		{
 			copyFrom(other);
@@ -241,6 +384,24 @@ namespace StdExt
 			return (size() != other.size() || 0 != mView.compare(other.mView));
 		}
 
+		template<size_t other_byte_size>
+		auto operator<=>(const StringBase<char_t, other_byte_size>& other) const noexcept
+		{
+			return mView <=> other.mView;
+		}
+
+		template<size_t other_byte_size>
+		bool operator==(const StringBase<char_t, other_byte_size>& other) const noexcept
+		{
+			return (size() == other.size() && 0 == mView.compare(other.mView));
+		}
+
+		template<size_t other_byte_size>
+		bool operator!=(const StringBase<char_t, other_byte_size>& other) const noexcept
+		{
+			return (size() != other.size() || 0 != mView.compare(other.mView));
+		}
+
 		StringBase operator+(const view_t& other) const
 		{
 			if (other.size() == 0)
@@ -248,7 +409,7 @@ namespace StdExt
 
 			size_t combinedSize = mView.size() + other.size();
 			char_t* outMemory = nullptr;
-			StringBase<char_t> ret;
+			StringBase ret;
 
 			if (combinedSize <= SmallSize)
 			{
@@ -289,6 +450,13 @@ namespace StdExt
 			*this += view_t(other);
 		}
 
+		/**
+		 * @brief
+		 *  Appends <i>other</i> to the string.  When the string is the only reference to
+		 *  its heap memory, that memory is grown in place with spare capacity, so repeated
+		 *  appends take amortized constant time per character.  New heap memory comes from
+		 *  the allocator of the current heap memory.
+		 */
 		void operator+=(const view_t& other)
 		{
 			if (other.size() == 0)
@@ -302,9 +470,22 @@ namespace StdExt
 				mView = view_t(&mSmallMemory[0], combinedSize);
 				mSmallMemory[combinedSize] = 0;
 			}
+			else if ( canAppendInPlace(other) )
+			{
+				size_t offset = mView.data() - mHeapReference.data();
+				size_t oldSize = size();
+
+				mHeapReference.resize(offset + combinedSize + 1);
+
+				char_t* memory = mHeapReference.data() + offset;
+				Collections::copy_n(other.data(), memory + oldSize, other.size());
+				memory[combinedSize] = 0;
+
+				mView = view_t(memory, combinedSize);
+			}
 			else
 			{
-				shared_array_t memory(combinedSize + 1);
+				shared_array_t memory(mHeapReference.allocator(), combinedSize + 1);
 				memory[combinedSize] = 0;
 
 				Collections::copy_n(data(), memory.data(), size());
@@ -320,24 +501,39 @@ namespace StdExt
 			*this += other.mView;
 		}
 
+		size_t find(char_t ch, size_t pos = 0) const
+		{
+			return Search::find(mView, ch, pos);
+		}
+
 		size_t find(const view_t& str, size_t pos = 0) const
 		{
-			return mView.find(str, pos);
+			return Search::find(mView, str, pos);
 		}
 
 		size_t find(const StringBase& str, size_t pos = 0) const
 		{
-			return mView.find(str.mView, pos);
+			return Search::find(mView, str.mView, pos);
+		}
+
+		size_t find(const char_t* str, size_t pos = 0) const
+		{
+			return Search::find(mView, view_t(str), pos);
 		}
 
 		size_t findFirstOf(const view_t& str, size_t pos = 0) const
 		{
-			return mView.find_first_of(str, pos);
+			return Search::findFirstOf(mView, str, pos);
 		}
 
 		size_t findFirstOf(const StringBase& str, size_t pos = 0) const
 		{
-			return mView.find_first_of(str.mView, pos);
+			return Search::findFirstOf(mView, str.mView, pos);
+		}
+
+		size_t findFirstOf(const char_t* str, size_t pos = 0) const
+		{
+			return Search::findFirstOf(mView, view_t(str), pos);
 		}
 
 		size_t findFirstNotOf(const view_t& str, size_t pos = 0) const
@@ -395,32 +591,120 @@ namespace StdExt
 			}
 		}
 
-		std::vector<StringBase> split(const view_t& deliminator, bool keepEmpty = true) const
+		/**
+		 * @brief
+		 *  Returns the string with its letters converted to lower case.
+		 *
+		 * @details
+		 *  Runs of ASCII are converted with SIMD instructions when available, and other
+		 *  characters use the simple case mapping of Unicode::toLower().  char strings
+		 *  only have their ASCII letters converted.  If no characters change, the result
+		 *  shares the memory of this string.  Calling this on an rvalue whose shared
+		 *  memory is not referenced by any other string converts that memory in place.
+		 */
+		StringBase toLower() const &
 		{
-			std::vector<StringBase> ret;
+			return convertCase(*this, Unicode::Case::Lower);
+		}
 
-			size_t strSize = size();
-			size_t delimSize = deliminator.size();
-			size_t begin = 0;
-			size_t end = 0;
+		StringBase toLower() &&
+		{
+			return convertCase(std::move(*this), Unicode::Case::Lower);
+		}
 
-			while (begin < strSize && end != npos)
-			{
-				end = find(deliminator, begin);
+		/**
+		 * @brief
+		 *  Returns the string with its letters converted to upper case.  This follows
+		 *  the same rules as toLower().
+		 */
+		StringBase toUpper() const &
+		{
+			return convertCase(*this, Unicode::Case::Upper);
+		}
 
-				if (end != npos)
-				{
-					if (keepEmpty || end != begin)
-						ret.push_back(substr(begin, end - begin));
+		StringBase toUpper() &&
+		{
+			return convertCase(std::move(*this), Unicode::Case::Upper);
+		}
 
-					begin = end + delimSize;
-				}
-			}
+		/**
+		 * @brief
+		 *  Returns the string without leading and trailing whitespace.  The result is
+		 *  a substring, so it shares the memory of this string unless it is small.
+		 */
+		StringBase trim() const
+		{
+			size_t leading = Unicode::leadingWhitespace(unicodeView(mView));
+
+			if (leading == size())
+				return (0 == leading) ? *this : substr(0, 0);
+
+			size_t trailing = Unicode::trailingWhitespace(unicodeView(mView));
+
+			if (0 == leading && 0 == trailing)
+				return *this;
+
+			return substr(leading, size() - leading - trailing);
+		}
+
+		StringBase trimLeading() const
+		{
+			size_t leading = Unicode::leadingWhitespace(unicodeView(mView));
+			return (0 == leading) ? *this : substr(leading);
+		}
+
+		StringBase trimTrailing() const
+		{
+			size_t trailing = Unicode::trailingWhitespace(unicodeView(mView));
+			return (0 == trailing) ? *this : substr(0, size() - trailing);
+		}
+
+		/**
+		 * @brief
+		 *  Compares the strings after case folding each character, using the same
+		 *  mappings as toLower() and toUpper().
+		 */
+		std::strong_ordering caseInsensitiveCompare(const view_t& other) const noexcept
+		{
+			return Unicode::caseInsensitiveCompare(unicodeView(mView), unicodeView(other));
+		}
+
+		bool caseInsensitiveEquals(const view_t& other) const noexcept
+		{
+			return std::is_eq(caseInsensitiveCompare(other));
+		}
 
-			if (begin < strSize)
-				ret.emplace_back(substr(begin, strSize - begin));
-			else if (begin == strSize && keepEmpty)
-				ret.emplace_back(StringBase());
+		class SplitView;
+
+		///@{
+		/**
+		 * @brief
+		 *  Returns a range that lazily yields the same substrings as split() without
+		 *  building a vector.  Yielded substrings share the memory of this string
+		 *  the same way as substr().
+		 */
+		SplitView splitView(const view_t& deliminator, bool keepEmpty = true) const
+		{
+			return SplitView(*this, StringBase(deliminator), keepEmpty);
+		}
+
+		SplitView splitView(const StringBase& deliminator, bool keepEmpty = true) const
+		{
+			return SplitView(*this, deliminator, keepEmpty);
+		}
+
+		SplitView splitView(const char_t* deliminator, bool keepEmpty = true) const
+		{
+			return SplitView(*this, StringBase(deliminator), keepEmpty);
+		}
+		///@}
+
+		std::vector<StringBase> split(const view_t& deliminator, bool keepEmpty = true) const
+		{
+			std::vector<StringBase> ret;
+
+			for ( const auto& item : SplitView(*this, literal(deliminator), keepEmpty) )
+				ret.push_back(item);
 
 			return ret;
 		}
@@ -444,14 +728,19 @@ namespace StdExt
 		 *  the class itself.  For data managed by the class, this can be determined.  All
 		 *  that data will eventually be null terminated, but if the object is not
 		 *  referencing the full set of shared data, it may not null-terminate at the
-		 *  end of the string of this object.
+		 *  end of the string of this object.  Adopted data is only null-terminated if
+		 *  the adopted memory contains a terminator after the string.
 		 */
 		bool isNullTerminated() const
 		{
-			if (isExternal())
+			if (isNull() || isExternal())
 				return false;
 
 			const char_t* addrNullCheck = mView.data() + mView.size();
+
+			if ( isOnHeap() && addrNullCheck >= mHeapReference.data() + mHeapReference.size() )
+				return false;
+
 			return *addrNullCheck == '\0';
 		}
 
@@ -535,6 +824,39 @@ namespace StdExt
 			return (nullptr == mView.data());
 		}
 
+		/**
+		 * @brief
+		 *  Hash of the string contents calculated by hashBytes().  Equal strings have
+		 *  equal hashes regardless of how their data is stored.
+		 *
+		 *  When STD_EXT_CACHE_STRING_HASH is defined, the hash of a string that views all
+		 *  of its shared memory is stored with that memory, so it is only calculated once
+		 *  for the string and all of its copies.
+		 */
+		size_t hash() const noexcept
+		{
+		#if defined(STD_EXT_CACHE_STRING_HASH)
+			if ( isOnHeap() &&
+			     mHeapReference.data() == mView.data() &&
+			     mHeapReference.size() == mView.size() + 1 )
+			{
+				uint64_t ret = mHeapReference.cachedHash();
+
+				if (0 == ret)
+				{
+					ret = hashBytes(mView.data(), mView.size() * sizeof(char_t));
+					mHeapReference.setCachedHash(ret);
+				}
+
+				return static_cast<size_t>(ret);
+			}
+		#endif
+
+			return static_cast<size_t>(
+				hashBytes(mView.data(), mView.size() * sizeof(char_t))
+			);
+		}
+
 		std::basic_string<char_t> toStdString() const
 		{
 			return std::basic_string<char_t>(mView);
@@ -546,6 +868,38 @@ namespace StdExt
 		}
 
 	private:
+		using unicode_view_t = std::basic_string_view<Unicode::unicode_unit_t<char_t>>;
+
+		static unicode_view_t unicodeView(const view_t& view) noexcept
+		{
+			return unicode_view_t(
+				access_as<const Unicode::unicode_unit_t<char_t>*>(view.data()), view.size()
+			);
+		}
+
+		static StringBase convertCase(StringBase str, Unicode::Case target)
+		{
+			size_t first_change = Unicode::findCaseChange(unicodeView(str.mView), target);
+
+			if (npos == first_change)
+				return str;
+
+			// Local memory belongs to str, so only shared memory needs to be checked.
+			if ( !str.isLocal() && !str.mHeapReference.isUnique() )
+				str = StringBase(str.mView);
+
+		#if defined(STD_EXT_CACHE_STRING_HASH)
+			str.mHeapReference.setCachedHash(0);
+		#endif
+
+			unicode_view_t changed = unicodeView(str.mView).substr(first_change);
+
+			Unicode::convertCase(
+				changed, const_cast<Unicode::unicode_unit_t<char_t>*>(changed.data()), target
+			);
+
+			return str;
+		}
 
 		void moveFrom(StringBase&& other) noexcept
 		{
@@ -583,7 +937,25 @@ namespace StdExt
 			}
 		}
 
-		void copyFrom(const view_t& view)
+		/**
+		 * @internal
+		 * @brief
+		 *  True if <i>other</i> can be appended by resizing the heap memory of this string.
+		 *  That memory must be referenced only by this string, the string must end at its
+		 *  terminator, and <i>other</i> must not be in memory that resizing could move.
+		 */
+		bool canAppendInPlace(const view_t& other) const
+		{
+			return
+				mHeapReference.isUnique() &&
+				mView.data() + mView.size() + 1 == mHeapReference.data() + mHeapReference.size() &&
+				!memory_overlaps(
+					other.data(), other.size(),
+					mHeapReference.data(), mHeapReference.capacity()
+				);
+		}
+
+		void copyFrom(const view_t& view, Allocator* allocator = nullptr)
 		{
 			if (view.size() <= SmallSize)
 			{
@@ -595,7 +967,10 @@ namespace StdExt
 			}
 			else
 			{
-				mHeapReference = shared_array_t(view.size() + 1);
+				mHeapReference = (allocator) ?
+					shared_array_t(*allocator, view.size() + 1) :
+					shared_array_t(view.size() + 1);
+
 				Collections::copy_n(view.data(), mHeapReference.data(), view.size());
 				mHeapReference[view.size()] = 0;
 
@@ -634,6 +1009,134 @@ namespace StdExt
 		std::array<char_t, SmallSize + 1>  mSmallMemory;
 	};
 
+	/**
+	 * @brief
+	 *  Range returned by StringBase::splitView().  It keeps its own reference to the
+	 *  source string and deliminator, and finds each substring as it is iterated.
+	 */
+	template<Character char_t, size_t small_byte_size>
+	class StringBase<char_t, small_byte_size>::SplitView
+	{
+	public:
+		class iterator
+		{
+			friend class SplitView;
+
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = StringBase;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const StringBase*;
+			using reference = const StringBase&;
+
+			iterator() = default;
+
+			reference operator*() const
+			{
+				return mCurrent;
+			}
+
+			pointer operator->() const
+			{
+				return &mCurrent;
+			}
+
+			iterator& operator++()
+			{
+				advance();
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator ret = *this;
+				advance();
+
+				return ret;
+			}
+
+			bool operator==(std::default_sentinel_t) const
+			{
+				return (nullptr == mParent);
+			}
+
+		private:
+			explicit iterator(const SplitView* parent)
+				: mParent(parent)
+			{
+				advance();
+			}
+
+			void advance()
+			{
+				const StringBase& source = mParent->mSource;
+				const size_t source_size = source.size();
+				const size_t delim_size = mParent->mDeliminator.size();
+
+				while (mNext <= source_size)
+				{
+					size_t begin = mNext;
+					size_t end = (begin < source_size && delim_size > 0) ?
+						source.find(mParent->mDeliminator.mView, begin) : npos;
+
+					if (end != npos)
+					{
+						mNext = end + delim_size;
+
+						if (mParent->mKeepEmpty || end != begin)
+						{
+							mCurrent = source.substr(begin, end - begin);
+							return;
+						}
+					}
+					else
+					{
+						mNext = source_size + 1;
+
+						if (begin < source_size || mParent->mKeepEmpty)
+						{
+							mCurrent = source.substr(begin);
+							return;
+						}
+					}
+				}
+
+				mParent = nullptr;
+				mCurrent = StringBase();
+			}
+
+			const SplitView* mParent = nullptr;
+			size_t mNext = 0;
+			StringBase mCurrent;
+		};
+
+		SplitView(StringBase source, StringBase deliminator, bool keepEmpty)
+			: mSource(std::move(source)),
+			  mDeliminator(std::move(deliminator)),
+			  mKeepEmpty(keepEmpty)
+		{
+		}
+
+		/**
+		 * @brief
+		 *  The returned iterator references this range, which must outlive it.
+		 */
+		iterator begin() const
+		{
+			return iterator(this);
+		}
+
+		std::default_sentinel_t end() const
+		{
+			return std::default_sentinel;
+		}
+
+	private:
+		StringBase mSource;
+		StringBase mDeliminator;
+		bool mKeepEmpty;
+	};
+
 	using CString = StringBase<char>;
 	using U8String = StringBase<char8_t>;
 	using U16String = StringBase<char16_t>;
@@ -642,6 +1145,12 @@ namespace StdExt
 
 	using String = U8String;
 
+	using U8String32 = StringBase<char8_t, 32>;
+	using U8String64 = StringBase<char8_t, 64>;
+
+	using String32 = U8String32;
+	using String64 = U8String64;
+
 	template<Character to_t, Character from_t>
 	StringBase<to_t> convertString(const StringBase<from_t>& str);
 
@@ -741,10 +1250,10 @@ namespace StdExt
 	}
 }
 
-template<StdExt::Character char_t>
-StdExt::StringBase<char_t> operator+(typename StdExt::StringBase<char_t>::view_t left, const StdExt::StringBase<char_t>& right)
+template<StdExt::Character char_t, size_t small_byte_size>
+StdExt::StringBase<char_t, small_byte_size> operator+(typename StdExt::StringBase<char_t, small_byte_size>::view_t left, const StdExt::StringBase<char_t, small_byte_size>& right)
 {
-	using view_t = typename StdExt::StringBase<char_t>::view_t;
+	using view_t = typename StdExt::StringBase<char_t, small_byte_size>::view_t;
 
 	size_t combined_size = left.size() + right.size();
 	char_t* out_buffer = nullptr;
@@ -756,30 +1265,54 @@ StdExt::StringBase<char_t> operator+(typename StdExt::StringBase<char_t>::view_t
 		out[combined_size] = 0;
 	};
 
-	if (combined_size > StdExt::StringBase<char_t>::SmallSize)
+	if (combined_size > StdExt::StringBase<char_t, small_byte_size>::SmallSize)
 	{
-		typename StdExt::StringBase<char_t>::shared_array_t string_data(combined_size + 1);
+		typename StdExt::StringBase<char_t, small_byte_size>::shared_array_t string_data(combined_size + 1);
 		writeCombined(string_data.data());
 
-		return StdExt::StringBase<char_t>(std::move(string_data));
+		return StdExt::StringBase<char_t, small_byte_size>(std::move(string_data));
 	}
 	else
 	{
-		std::array<char_t, StdExt::StringBase<char_t>::SmallSize + 1> string_data;
+		std::array<char_t, StdExt::StringBase<char_t, small_byte_size>::SmallSize + 1> string_data;
 		writeCombined(string_data.data());
 
-		return StdExt::StringBase<char_t>(
-			view_t(string_data.data(), string_data.size() - 1)
+		return StdExt::StringBase<char_t, small_byte_size>(
+			view_t(string_data.data(), combined_size)
 			);
 	}
 }
 
-template<StdExt::Character char_t>
-StdExt::StringBase<char_t> operator+(const char_t* left, const StdExt::StringBase<char_t>& right)
+template<StdExt::Character char_t, size_t small_byte_size>
+StdExt::StringBase<char_t, small_byte_size> operator+(const char_t* left, const StdExt::StringBase<char_t, small_byte_size>& right)
 {
-	return StdExt::StringBase<char_t>::view_t(left) + right;
+	return StdExt::StringBase<char_t, small_byte_size>::view_t(left) + right;
 }
 
+/**
+ * @brief
+ *  Hashes strings with StringBase::hash().  The hash is transparent, so containers
+ *  using it with std::equal_to<> can be searched with string views without
+ *  constructing a StringBase.
+ */
+template<StdExt::Character char_t, size_t small_byte_size>
+struct std::hash<StdExt::StringBase<char_t, small_byte_size>>
+{
+	using is_transparent = void;
+
+	size_t operator()(const StdExt::StringBase<char_t, small_byte_size>& str) const noexcept
+	{
+		return str.hash();
+	}
+
+	size_t operator()(std::basic_string_view<char_t> str) const noexcept
+	{
+		return static_cast<size_t>(
+			StdExt::hashBytes(str.data(), str.size() * sizeof(char_t))
+		);
+	}
+};
+
 namespace StdExt::Serialize::Binary
 {
 	template<>
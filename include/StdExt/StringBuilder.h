@@ -0,0 +1,264 @@
+#ifndef _STD_EXT_STRING_BUILDER_H_
+#define _STD_EXT_STRING_BUILDER_H_
+
+#include "String.h"
+
+#include "Memory/Utility.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace StdExt
+{
+	/**
+	 * @brief
+	 *  Accumulates string pieces for the construction of a single StringBase.
+	 *
+	 * @details
+	 *  Appending to a StringBase beyond its small size allocates new shared memory and copies
+	 *  both the existing string and the appended data, making the construction of a large
+	 *  string through repeated appends quadratic.  %StringBuilder instead stores appended
+	 *  data in chunks whose capacities grow geometrically.  Chunks are never reallocated, so
+	 *  previously appended data is not copied again until toString() is called, which
+	 *  creates the final string with a single allocation.
+	 */
+	template<Character char_t>
+	class StringBuilder final
+	{
+	public:
+		using string_t = StringBase<char_t>;
+		using view_t = typename string_t::view_t;
+
+		/**
+		 * @brief
+		 *  The capacity, in characters, of the first chunk allocated when no
+		 *  capacity has been reserved.
+		 */
+		static constexpr size_t InitialChunkSize = 64;
+
+	private:
+		struct Chunk
+		{
+			char_t* data = nullptr;
+			size_t size = 0;
+			size_t capacity = 0;
+		};
+
+		std::vector<Chunk> mChunks;
+		size_t mSize = 0;
+		size_t mCapacity = 0;
+
+		void addChunk(size_t min_capacity)
+		{
+			size_t capacity = std::max(
+				{ min_capacity, mCapacity, InitialChunkSize }
+			);
+
+			Chunk chunk;
+			chunk.data = allocate_n<char_t>(capacity);
+			chunk.capacity = capacity;
+
+			mChunks.push_back(chunk);
+			mCapacity += capacity;
+		}
+
+		void freeChunks() noexcept
+		{
+			for (auto& chunk : mChunks)
+				free_n(chunk.data);
+
+			mChunks.clear();
+			mSize = 0;
+			mCapacity = 0;
+		}
+
+	public:
+		StringBuilder(const StringBuilder&) = delete;
+		StringBuilder& operator=(const StringBuilder&) = delete;
+
+		StringBuilder() = default;
+
+		/**
+		 * @brief
+		 *  Creates a builder with space already allocated for <i>char_count</i>
+		 *  characters.
+		 */
+		explicit StringBuilder(size_t char_count)
+		{
+			reserve(char_count);
+		}
+
+		StringBuilder(StringBuilder&& other) noexcept
+			: mChunks(std::move(other.mChunks)),
+			  mSize(other.mSize), mCapacity(other.mCapacity)
+		{
+			other.mChunks.clear();
+			other.mSize = 0;
+			other.mCapacity = 0;
+		}
+
+		~StringBuilder()
+		{
+			freeChunks();
+		}
+
+		StringBuilder& operator=(StringBuilder&& other) noexcept
+		{
+			if (this != &other)
+			{
+				freeChunks();
+
+				mChunks = std::move(other.mChunks);
+				mSize = other.mSize;
+				mCapacity = other.mCapacity;
+
+				other.mChunks.clear();
+				other.mSize = 0;
+				other.mCapacity = 0;
+			}
+
+			return *this;
+		}
+
+		/**
+		 * @brief
+		 *  Makes sure that at least <i>char_count</i> more characters can be
+		 *  appended without any further allocation.
+		 */
+		void reserve(size_t char_count)
+		{
+			size_t available = (mChunks.empty()) ?
+				0 : mChunks.back().capacity - mChunks.back().size;
+
+			if (char_count > available)
+				addChunk(char_count);
+		}
+
+		StringBuilder& append(view_t str)
+		{
+			size_t remaining = str.size();
+			const char_t* source = str.data();
+
+			while (remaining > 0)
+			{
+				if ( mChunks.empty() || mChunks.back().size == mChunks.back().capacity )
+					addChunk(remaining);
+
+				Chunk& chunk = mChunks.back();
+				size_t copy_amount = std::min(remaining, chunk.capacity - chunk.size);
+
+				Collections::copy_n(source, chunk.data + chunk.size, copy_amount);
+
+				chunk.size += copy_amount;
+				mSize += copy_amount;
+				source += copy_amount;
+				remaining -= copy_amount;
+			}
+
+			return *this;
+		}
+
+		StringBuilder& append(const string_t& str)
+		{
+			return append(str.view());
+		}
+
+		StringBuilder& append(const char_t* str)
+		{
+			return append(view_t(str));
+		}
+
+		StringBuilder& append(char_t ch)
+		{
+			return append(view_t(&ch, 1));
+		}
+
+		StringBuilder& operator+=(view_t str)
+		{
+			return append(str);
+		}
+
+		StringBuilder& operator+=(const string_t& str)
+		{
+			return append(str.view());
+		}
+
+		StringBuilder& operator+=(const char_t* str)
+		{
+			return append(view_t(str));
+		}
+
+		StringBuilder& operator+=(char_t ch)
+		{
+			return append(ch);
+		}
+
+		/**
+		 * @brief
+		 *  The number of characters that have been appended.
+		 */
+		size_t size() const
+		{
+			return mSize;
+		}
+
+		/**
+		 * @brief
+		 *  The number of characters that can be stored in currently allocated chunks.
+		 */
+		size_t capacity() const
+		{
+			return mCapacity;
+		}
+
+		/**
+		 * @brief
+		 *  Discards all appended data and releases allocated chunks.
+		 */
+		void clear()
+		{
+			freeChunks();
+		}
+
+		/**
+		 * @brief
+		 *  Creates a string of all appended data.  Strings that do not fit in the small
+		 *  memory of a StringBase are written directly into a single shared allocation.
+		 *  The builder is left unchanged and can continue to be appended.
+		 */
+		string_t toString() const
+		{
+			if ( mSize <= string_t::SmallSize )
+			{
+				std::array<char_t, string_t::SmallSize> local_chars;
+				copyTo(local_chars.data());
+
+				return string_t( view_t(local_chars.data(), mSize) );
+			}
+
+			typename string_t::shared_array_t memory(mSize + 1);
+			copyTo(memory.data());
+			memory[mSize] = 0;
+
+			return string_t(std::move(memory));
+		}
+
+	private:
+		void copyTo(char_t* destination) const
+		{
+			for (const auto& chunk : mChunks)
+			{
+				Collections::copy_n(chunk.data, destination, chunk.size);
+				destination += chunk.size;
+			}
+		}
+	};
+
+	using CStringBuilder = StringBuilder<char>;
+	using U8StringBuilder = StringBuilder<char8_t>;
+	using U16StringBuilder = StringBuilder<char16_t>;
+	using U32StringBuilder = StringBuilder<char32_t>;
+	using WStringBuilder = StringBuilder<wchar_t>;
+}
+
+#endif // !_STD_EXT_STRING_BUILDER_H_
@@ -0,0 +1,176 @@
+#ifndef _STD_EXT_UNICODE_H_
+#define _STD_EXT_UNICODE_H_
+
+#include "StdExt.h"
+#include "Concepts.h"
+#include "Exceptions.h"
+
+#include <compare>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @brief
+ *  Validation and transcoding between the UTF-8, UTF-16, and UTF-32 encodings.
+ *
+ * @details
+ *  Transcoding is implemented natively without any lookup tables, locale state, or
+ *  platform conversion facilities.  Runs of ASCII characters are detected and
+ *  converted with SIMD instructions when available.  Conversion is split into
+ *  transcodedLength(), which validates the input and calculates the exact size
+ *  of the output, and transcode(), which writes the output.  This allows a caller
+ *  to allocate the destination exactly once.
+ *
+ *  Simple case mapping, case insensitive comparison, and whitespace detection are
+ *  also provided for strings of any Character type.  char strings are in a locale
+ *  dependent encoding, so only their ASCII characters are interpreted.
+ */
+namespace StdExt::Unicode
+{
+	/**
+	 * @brief
+	 *  The largest valid unicode code point.
+	 */
+	static constexpr char32_t MaxCodePoint = 0x10FFFF;
+
+	/**
+	 * @brief
+	 *  The character type with the same encoding as char_t.  wchar_t strings are UTF-16
+	 *  where wchar_t is two bytes, and UTF-32 otherwise.
+	 */
+	template<Character char_t>
+	using unicode_unit_t = std::conditional_t<
+		std::same_as<char_t, wchar_t>,
+		std::conditional_t<sizeof(wchar_t) == 2, char16_t, char32_t>,
+		char_t
+	>;
+
+	/**
+	 * @brief
+	 *  Target of a case conversion.
+	 */
+	enum class Case
+	{
+		Lower,
+		Upper
+	};
+
+	/**
+	 * @brief
+	 *  Thrown when a string does not contain a valid encoding.  offset() is the
+	 *  index of the code unit at which the invalid sequence begins.
+	 */
+	class STD_EXT_EXPORT encoding_error : public format_error
+	{
+	public:
+		encoding_error(const char* message, size_t offset);
+		encoding_error(const std::string& message, size_t offset);
+
+		size_t offset() const noexcept;
+
+	private:
+		size_t mOffset;
+	};
+
+	///@{
+	/**
+	 * @brief
+	 *  Returns the number of leading code units in <i>str</i> that are ASCII characters.
+	 */
+	STD_EXT_EXPORT size_t asciiLength(std::u8string_view str) noexcept;
+	STD_EXT_EXPORT size_t asciiLength(std::u16string_view str) noexcept;
+	STD_EXT_EXPORT size_t asciiLength(std::u32string_view str) noexcept;
+	///@}
+
+	///@{
+	/**
+	 * @brief
+	 *  Returns the offset of the first code unit of the first invalid sequence in
+	 *  <i>str</i>, or std::string_view::npos if the entire string is valid.
+	 */
+	STD_EXT_EXPORT size_t findInvalid(std::u8string_view str) noexcept;
+	STD_EXT_EXPORT size_t findInvalid(std::u16string_view str) noexcept;
+	STD_EXT_EXPORT size_t findInvalid(std::u32string_view str) noexcept;
+	///@}
+
+	/**
+	 * @brief
+	 *  Validates <i>str</i> and returns the exact number of to_t code units needed
+	 *  to represent it.  An encoding_error is thrown if <i>str</i> is not valid.
+	 */
+	template<UnicodeCharacter to_t, UnicodeCharacter from_t>
+	STD_EXT_EXPORT size_t transcodedLength(std::basic_string_view<from_t> str);
+
+	/**
+	 * @brief
+	 *  Writes <i>str</i> converted to the encoding of to_t into <i>out</i>, which must
+	 *  have space for the number of code units returned by transcodedLength().  The
+	 *  number of code units written is returned.  No null terminator is written.  An
+	 *  encoding_error is thrown if <i>str</i> is not valid.
+	 */
+	template<UnicodeCharacter to_t, UnicodeCharacter from_t>
+	STD_EXT_EXPORT size_t transcode(std::basic_string_view<from_t> str, to_t* out);
+
+	///@{
+	/**
+	 * @brief
+	 *  Simple one-to-one case mapping of a code point.
+	 *
+	 * @details
+	 *  Mappings cover the Latin-1, Latin Extended-A, Latin Extended Additional, Greek,
+	 *  Cyrillic, Armenian, Fullwidth Latin, and Deseret letters.  Only mappings between
+	 *  code points with the same encoded length in UTF-8 and UTF-16 are included, so
+	 *  case conversion never changes the length of a string.  Code points without a
+	 *  mapping are returned unchanged.
+	 */
+	STD_EXT_EXPORT char32_t toLower(char32_t code_point) noexcept;
+	STD_EXT_EXPORT char32_t toUpper(char32_t code_point) noexcept;
+	///@}
+
+	/**
+	 * @brief
+	 *  Returns true for code points with the unicode White_Space property.
+	 */
+	STD_EXT_EXPORT bool isWhitespace(char32_t code_point) noexcept;
+
+	/**
+	 * @brief
+	 *  Returns the offset of the first code unit in <i>str</i> that would be changed by
+	 *  convertCase(), or npos if converting would not change the string.
+	 */
+	template<Character char_t>
+	STD_EXT_EXPORT size_t findCaseChange(std::basic_string_view<char_t> str, Case target) noexcept;
+
+	/**
+	 * @brief
+	 *  Writes <i>str</i> converted to the <i>target</i> case into <i>out</i>, which must
+	 *  have space for str.size() code units.  <i>out</i> may be the data of <i>str</i>
+	 *  to convert in place.  Invalid sequences are copied unchanged.
+	 */
+	template<Character char_t>
+	STD_EXT_EXPORT void convertCase(std::basic_string_view<char_t> str, char_t* out, Case target) noexcept;
+
+	/**
+	 * @brief
+	 *  Compares strings by their case folded code points.
+	 */
+	template<Character char_t>
+	STD_EXT_EXPORT std::strong_ordering caseInsensitiveCompare(
+		std::basic_string_view<char_t> left,
+		std::basic_string_view<char_t> right
+	) noexcept;
+
+	///@{
+	/**
+	 * @brief
+	 *  The number of code units of whitespace at the start or end of <i>str</i>.
+	 */
+	template<Character char_t>
+	STD_EXT_EXPORT size_t leadingWhitespace(std::basic_string_view<char_t> str) noexcept;
+
+	template<Character char_t>
+	STD_EXT_EXPORT size_t trailingWhitespace(std::basic_string_view<char_t> str) noexcept;
+	///@}
+}
+
+#endif // !_STD_EXT_UNICODE_H_
@@ -6,6 +6,7 @@
 #include "Compare.h"
 #include "Utility.h"
 #include "Number.h"
+#include "Format.h"
 
 #include "Serialize/Binary/Binary.h"
 #include "Serialize/Text/Text.h"
@@ -1270,6 +1271,41 @@ namespace StdExt
 		}
 	}
 
+	/**
+	 * @brief
+	 *  Formats the components of a vector separated by ", ", the same text used by
+	 *  text and XML serialization.
+	 */
+	template<VecType num_t>
+	class Formatter<Vec2<num_t>> : public Detail::ListFormatter<Formatter<num_t>, 2, false>
+	{
+	public:
+		Formatter(const Vec2<num_t>& value)
+			: Detail::ListFormatter<Formatter<num_t>, 2, false>(value)
+		{
+		}
+	};
+
+	template<VecType num_t>
+	class Formatter<Vec3<num_t>> : public Detail::ListFormatter<Formatter<num_t>, 3, false>
+	{
+	public:
+		Formatter(const Vec3<num_t>& value)
+			: Detail::ListFormatter<Formatter<num_t>, 3, false>(value)
+		{
+		}
+	};
+
+	template<VecType num_t>
+	class Formatter<Vec4<num_t>> : public Detail::ListFormatter<Formatter<num_t>, 4, false>
+	{
+	public:
+		Formatter(const Vec4<num_t>& value)
+			: Detail::ListFormatter<Formatter<num_t>, 4, false>(value)
+		{
+		}
+	};
+
 	namespace Serialize::Binary
 	{
 		template<>
@@ -1,17 +1,138 @@
 #include <StdExt/Buffer.h>
+#include <StdExt/Platform.h>
 #include <StdExt/Utility.h>
 #include <StdExt/Memory/Alignment.h>
 
 #include <StdExt/Serialize/Binary/Binary.h>
 #include <StdExt/Streams/ByteStream.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <new>
 #include <stdexcept>
 #include <type_traits>
 
+#if defined(STD_EXT_LINUX)
+#	include <sys/mman.h>
+#	include <unistd.h>
+#endif
+
 namespace StdExt
 {
+	namespace
+	{
+	#if defined(STD_EXT_LINUX)
+		/**
+		 * @internal
+		 * @brief
+		 *  Buffers at least this large are mapped directly from the system, so growing
+		 *  them remaps their pages instead of copying their contents.
+		 */
+		constexpr size_t MapThreshold = 1024 * 1024;
+
+		size_t pageSize()
+		{
+			static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			return page_size;
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Whether a buffer of <i>size</i> and <i>alignment</i> is mapped.  This depends
+		 *  only on the size and alignment, so Buffer does not need to track it.
+		 */
+		bool isMapped(size_t size, size_t alignment)
+		{
+			return (size >= MapThreshold && alignment <= pageSize());
+		}
+
+		size_t mappedLength(size_t size)
+		{
+			return nextMultipleOf<size_t>(size, pageSize());
+		}
+
+		void* mapMemory(size_t size)
+		{
+			void* ret = mmap(nullptr, mappedLength(size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if (MAP_FAILED == ret)
+				throw std::bad_alloc();
+
+			return ret;
+		}
+	#else
+		bool isMapped([[maybe_unused]] size_t size, [[maybe_unused]] size_t alignment)
+		{
+			return false;
+		}
+	#endif
+
+		void* allocate(size_t size, size_t alignment)
+		{
+		#if defined(STD_EXT_LINUX)
+			if ( isMapped(size, alignment) )
+				return mapMemory(size);
+		#endif
+
+			return alloc_aligned(size, alignment);
+		}
+
+		void deallocate(void* ptr, size_t size, size_t alignment)
+		{
+		#if defined(STD_EXT_LINUX)
+			if ( isMapped(size, alignment) )
+			{
+				munmap(ptr, mappedLength(size));
+				return;
+			}
+		#endif
+
+			free_aligned(ptr);
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Resizes memory from allocate().  Mapped memory that stays mapped is resized with
+		 *  mremap(), which moves pages instead of copying them, and is left in place when
+		 *  the number of pages does not change.
+		 */
+		void* reallocate(void* ptr, size_t old_size, size_t old_alignment, size_t size, size_t alignment)
+		{
+			bool was_mapped = isMapped(old_size, old_alignment);
+			bool will_map = isMapped(size, alignment);
+
+		#if defined(STD_EXT_LINUX)
+			if ( was_mapped && will_map )
+			{
+				size_t old_length = mappedLength(old_size);
+				size_t length = mappedLength(size);
+
+				if ( old_length == length )
+					return ptr;
+
+				void* ret = mremap(ptr, old_length, length, MREMAP_MAYMOVE);
+
+				if (MAP_FAILED == ret)
+					throw std::bad_alloc();
+
+				return ret;
+			}
+		#endif
+
+			if ( !was_mapped && !will_map )
+				return realloc_aligned(ptr, size, alignment);
+
+			void* ret = allocate(size, alignment);
+			memcpy(ret, ptr, std::min(old_size, size));
+			deallocate(ptr, old_size, old_alignment);
+
+			return ret;
+		}
+	}
+
 	Buffer::Buffer()
 	{
 		mSize = 0;
@@ -33,7 +154,7 @@ namespace StdExt
 
 	Buffer::Buffer(const Buffer& other)
 	{
-		mBuffer = alloc_aligned(other.mSize, other.mAlignment);
+		mBuffer = allocate(other.mSize, other.mAlignment);
 		memcpy(mBuffer, other.mBuffer, other.mSize);
 
 		mSize = other.mSize;
@@ -50,7 +171,7 @@ namespace StdExt
 	Buffer::~Buffer()
 	{
 		if (nullptr != mBuffer)
-			free_aligned(mBuffer);
+			deallocate(mBuffer, mSize, mAlignment);
 	}
 
 	size_t Buffer::size() const
@@ -71,20 +192,20 @@ namespace StdExt
 		{
 			if (0 == size)
 			{
-				free_aligned(mBuffer);
+				deallocate(mBuffer, mSize, mAlignment);
 				mBuffer = nullptr;
 				mSize = 0;
 			}
 			else
 			{
-				mBuffer = realloc_aligned(mBuffer, size, alignment);
+				mBuffer = reallocate(mBuffer, mSize, mAlignment, size, alignment);
 				mAlignment = alignment;
 				mSize = size;
 			}
 		}
 		else if (0 != size)
 		{
-			mBuffer = alloc_aligned(size, alignment);
+			mBuffer = allocate(size, alignment);
 			mAlignment = alignment;
 			mSize = size;
 		}
@@ -103,7 +224,7 @@ namespace StdExt
 	Buffer& Buffer::operator=(Buffer&& other)
 	{
 		if (nullptr != mBuffer)
-			free_aligned(mBuffer);
+			deallocate(mBuffer, mSize, mAlignment);
 
 		mSize = other.mSize;
 		other.mSize = 0;
@@ -119,18 +240,21 @@ namespace StdExt
 
 	Buffer& Buffer::operator=(const Buffer& other)
 	{
+		if (this == &other)
+			return *this;
+
 		if (nullptr != mBuffer)
 		{
-			free_aligned(mBuffer);
+			deallocate(mBuffer, mSize, mAlignment);
 
 			mBuffer = nullptr;
 			mSize = 0;
 			mAlignment = 0;
 		}
 
-		if (mSize > 0)
+		if (other.mSize > 0)
 		{
-			mBuffer = alloc_aligned(other.mSize, other.mAlignment);
+			mBuffer = allocate(other.mSize, other.mAlignment);
 			memcpy(mBuffer, other.mBuffer, other.mSize);
 
 			mSize = other.mSize;
@@ -0,0 +1,127 @@
+#include <StdExt/Format.h>
+
+#include <StdExt/Search.h>
+
+namespace StdExt::Detail
+{
+	namespace
+	{
+		/**
+		 * @internal
+		 * @brief
+		 *  Walks <i>fmt</i>, passing each run of literal text to <i>onText</i> and each
+		 *  placeholder to <i>onArg</i> along with the argument it consumes.
+		 */
+		template<Character char_t, typename on_text_t, typename on_arg_t>
+		void parseFormat(
+			std::basic_string_view<char_t> fmt,
+			const FormatArg<char_t>* args, size_t arg_count,
+			on_text_t&& onText, on_arg_t&& onArg
+		)
+		{
+			static constexpr char_t braces[] = { char_t('{'), char_t('}') };
+			const std::basic_string_view<char_t> brace_set(braces, 2);
+
+			size_t next_arg = 0;
+			size_t pos = 0;
+
+			while ( pos < fmt.size() )
+			{
+				size_t brace = Search::findFirstOf(fmt, brace_set, pos);
+
+				if ( brace == std::basic_string_view<char_t>::npos )
+				{
+					onText(fmt.substr(pos));
+					break;
+				}
+
+				if ( brace + 1 >= fmt.size() )
+					throw format_error("Unmatched brace at the end of the format string.");
+
+				char_t ch = fmt[brace];
+				char_t following = fmt[brace + 1];
+
+				if ( ch == char_t('{') && following == char_t('}') )
+				{
+					if ( next_arg >= arg_count )
+						throw format_error("The format string has more placeholders than arguments.");
+
+					onText(fmt.substr(pos, brace - pos));
+					onArg(args[next_arg++]);
+				}
+				else if ( ch == following )
+				{
+					onText(fmt.substr(pos, brace - pos + 1));
+				}
+				else
+				{
+					throw format_error("Format strings only support \"{}\" placeholders and \"{{\" or \"}}\" escapes.");
+				}
+
+				pos = brace + 2;
+			}
+
+			if ( next_arg != arg_count )
+				throw format_error("The format string has fewer placeholders than arguments.");
+		}
+
+		template<Character char_t>
+		void writeFormat(
+			std::basic_string_view<char_t> fmt,
+			const FormatArg<char_t>* args, size_t arg_count,
+			char_t* out
+		)
+		{
+			parseFormat<char_t>(
+				fmt, args, arg_count,
+				[&](std::basic_string_view<char_t> text)
+				{
+					std::memcpy(out, text.data(), text.size() * sizeof(char_t));
+					out += text.size();
+				},
+				[&](const FormatArg<char_t>& arg)
+				{
+					out = arg.write(arg.formatter, out);
+				}
+			);
+		}
+	}
+
+	template<Character char_t>
+	StringBase<char_t> formatArgs(
+		std::basic_string_view<char_t> fmt,
+		const FormatArg<char_t>* args,
+		size_t arg_count
+	)
+	{
+		using string_t = StringBase<char_t>;
+
+		size_t length = 0;
+
+		parseFormat<char_t>(
+			fmt, args, arg_count,
+			[&](std::basic_string_view<char_t> text) { length += text.size(); },
+			[&](const FormatArg<char_t>& arg) { length += arg.size; }
+		);
+
+		if ( length <= string_t::SmallSize )
+		{
+			std::array<char_t, string_t::SmallSize> local_chars;
+			writeFormat<char_t>(fmt, args, arg_count, local_chars.data());
+
+			return string_t( typename string_t::view_t(local_chars.data(), length) );
+		}
+
+		typename string_t::shared_array_t memory(length + 1);
+		writeFormat<char_t>(fmt, args, arg_count, memory.data());
+		memory[length] = 0;
+
+		return string_t(std::move(memory));
+	}
+
+	template StringBase<char> formatArgs<char>(std::string_view, const FormatArg<char>*, size_t);
+	template StringBase<char8_t> formatArgs<char8_t>(std::u8string_view, const FormatArg<char8_t>*, size_t);
+	template StringBase<char16_t> formatArgs<char16_t>(std::u16string_view, const FormatArg<char16_t>*, size_t);
+	template StringBase<char32_t> formatArgs<char32_t>(std::u32string_view, const FormatArg<char32_t>*, size_t);
+	template StringBase<wchar_t> formatArgs<wchar_t>(std::wstring_view, const FormatArg<wchar_t>*, size_t);
+}
@@ -0,0 +1,151 @@
+#include <StdExt/Hash.h>
+
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#	include <intrin.h>
+#endif
+
+namespace StdExt
+{
+	namespace
+	{
+		constexpr uint64_t Secret[4] =
+		{
+			0xa0761d6478bd642full,
+			0xe7037ed1a0b428dbull,
+			0x8ebc6af09c88c6e3ull,
+			0x589965cc75374cc3ull
+		};
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Replaces <i>a</i> and <i>b</i> with the low and high 64 bits of their
+		 *  128-bit product.
+		 */
+		inline void multiply(uint64_t& a, uint64_t& b) noexcept
+		{
+		#if defined(__SIZEOF_INT128__)
+			unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+			a = static_cast<uint64_t>(product);
+			b = static_cast<uint64_t>(product >> 64);
+		#elif defined(_MSC_VER) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+		#else
+			uint64_t a_high = a >> 32, a_low = static_cast<uint32_t>(a);
+			uint64_t b_high = b >> 32, b_low = static_cast<uint32_t>(b);
+
+			uint64_t high_high = a_high * b_high;
+			uint64_t high_low = a_high * b_low;
+			uint64_t low_high = a_low * b_high;
+			uint64_t low_low = a_low * b_low;
+
+			uint64_t cross = (low_low >> 32) + static_cast<uint32_t>(high_low) + low_high;
+
+			a = (cross << 32) | static_cast<uint32_t>(low_low);
+			b = high_high + (high_low >> 32) + (cross >> 32);
+		#endif
+		}
+
+		inline uint64_t mix(uint64_t a, uint64_t b) noexcept
+		{
+			multiply(a, b);
+			return a ^ b;
+		}
+
+		inline uint64_t read64(const uint8_t* ptr) noexcept
+		{
+			uint64_t ret;
+			memcpy(&ret, ptr, sizeof(ret));
+
+			return ret;
+		}
+
+		inline uint64_t read32(const uint8_t* ptr) noexcept
+		{
+			uint32_t ret;
+			memcpy(&ret, ptr, sizeof(ret));
+
+			return ret;
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Reads 1 to 3 bytes, covering the first, middle, and last.
+		 */
+		inline uint64_t readSmall(const uint8_t* ptr, size_t count) noexcept
+		{
+			return
+				(static_cast<uint64_t>(ptr[0]) << 16) |
+				(static_cast<uint64_t>(ptr[count >> 1]) << 8) |
+				ptr[count - 1];
+		}
+	}
+
+	uint64_t hashBytes(const void* data, size_t byte_count, uint64_t seed) noexcept
+	{
+		const uint8_t* ptr = static_cast<const uint8_t*>(data);
+
+		seed ^= mix(seed ^ Secret[0], Secret[1]);
+
+		uint64_t a = 0;
+		uint64_t b = 0;
+
+		if (byte_count <= 16)
+		{
+			if (byte_count >= 4)
+			{
+				size_t middle = (byte_count >> 3) << 2;
+
+				a = (read32(ptr) << 32) | read32(ptr + middle);
+				b = (read32(ptr + byte_count - 4) << 32) | read32(ptr + byte_count - 4 - middle);
+			}
+			else if (byte_count > 0)
+			{
+				a = readSmall(ptr, byte_count);
+			}
+		}
+		else
+		{
+			size_t remaining = byte_count;
+
+			if (remaining > 48)
+			{
+				uint64_t lane_1 = seed;
+				uint64_t lane_2 = seed;
+
+				do
+				{
+					seed = mix(read64(ptr) ^ Secret[1], read64(ptr + 8) ^ seed);
+					lane_1 = mix(read64(ptr + 16) ^ Secret[2], read64(ptr + 24) ^ lane_1);
+					lane_2 = mix(read64(ptr + 32) ^ Secret[3], read64(ptr + 40) ^ lane_2);
+
+					ptr += 48;
+					remaining -= 48;
+				}
+				while (remaining > 48);
+
+				seed ^= lane_1 ^ lane_2;
+			}
+
+			while (remaining > 16)
+			{
+				seed = mix(read64(ptr) ^ Secret[1], read64(ptr + 8) ^ seed);
+
+				ptr += 16;
+				remaining -= 16;
+			}
+
+			a = read64(ptr + remaining - 16);
+			b = read64(ptr + remaining - 8);
+		}
+
+		a ^= Secret[1];
+		b ^= seed;
+		multiply(a, b);
+
+		return mix(a ^ Secret[0] ^ byte_count, b ^ Secret[1]);
+	}
+}
@@ -0,0 +1,17 @@
+#include <StdExt/InternedString.h>
+
+namespace StdExt
+{
+	template<Character char_t>
+	StringPool<char_t>& StringPool<char_t>::global()
+	{
+		static StringPool<char_t> pool;
+		return pool;
+	}
+
+	template StringPool<char>& StringPool<char>::global();
+	template StringPool<char8_t>& StringPool<char8_t>::global();
+	template StringPool<char16_t>& StringPool<char16_t>::global();
+	template StringPool<char32_t>& StringPool<char32_t>::global();
+	template StringPool<wchar_t>& StringPool<wchar_t>::global();
+}
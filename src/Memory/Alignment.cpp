@@ -3,6 +3,9 @@
 #include <StdExt/Platform.h>
 #include <StdExt/Utility.h>
 
+#include "SlabPool.h"
+
+#include <cstddef>
 #include <cstdlib>
 
 #if defined(STD_EXT_APPLE)
@@ -19,52 +22,127 @@
 
 namespace StdExt
 {
-	void* alloc_aligned(size_t size, size_t alignment)
+	namespace Detail
 	{
-		// apple-clang seems to have more strict parameter requirements.
-		#if defined (STD_EXT_APPLE)
-		alignment = nextMultipleOf<size_t>(alignment, sizeof(void*));
-		size = nextMultipleOf<size_t>(size, alignment);
-		#endif
+		void* system_alloc(size_t size, size_t alignment)
+		{
+			// apple-clang seems to have more strict parameter requirements.
+			#if defined (STD_EXT_APPLE)
+			alignment = nextMultipleOf<size_t>(alignment, sizeof(void*));
+			#endif
+
+			#if defined(STD_EXT_WIN32)
+				return (size > 0) ? _aligned_malloc(size, alignment) : nullptr;
+			#else
+				// aligned_alloc() requires the size to be a multiple of the alignment.
+				size = nextMultipleOf<size_t>(size, alignment);
+				return (size > 0) ? aligned_alloc(alignment, size) : nullptr;
+			#endif
+		}
+
+		void system_free(void* ptr)
+		{
+			#if defined(STD_EXT_WIN32)
+			if (nullptr != ptr)
+				_aligned_free(ptr);
+			#else
+				free(ptr);
+			#endif
+		}
 
+		void* system_realloc(void* ptr, size_t size, size_t alignment)
+		{
 		#if defined(STD_EXT_WIN32)
-			return (size > 0) ? _aligned_malloc(size, alignment) : nullptr;
+			if (nullptr != ptr)
+				return _aligned_realloc(ptr, size, alignment);
+
+			return nullptr;
 		#else
-			return (size > 0) ? aligned_alloc(alignment, size) : nullptr;
+			// Memory from aligned_alloc() can be passed to realloc(), which keeps any
+			// alignment that malloc() guarantees and may grow the block in place.
+			if (alignment <= alignof(std::max_align_t))
+				return realloc(ptr, size);
 		#endif
+
+		#if defined (STD_EXT_APPLE)
+			auto old_size = malloc_size(ptr);
+			void* ret = system_alloc(size, alignment);
+			memcpy(ret, ptr, std::min(old_size, size));
+			free(ptr);
+
+			return ret;
+		#elif defined(STD_EXT_GCC)
+			auto old_size = malloc_usable_size(ptr);
+			void* ret = system_alloc(size, alignment);
+			memcpy(ret, ptr, std::min(old_size, size));
+			free(ptr);
+
+			return ret;
+		#endif
+		}
+
+	#if defined(STD_EXT_POOLED_ALLOC)
+		void* backend_alloc(size_t size, size_t alignment)
+		{
+			return pool_alloc(size, alignment);
+		}
+
+		void backend_free(void* ptr)
+		{
+			pool_free(ptr);
+		}
+
+		void* backend_realloc(void* ptr, size_t size, size_t alignment)
+		{
+			return pool_realloc(ptr, size, alignment);
+		}
+	#else
+		void* backend_alloc(size_t size, size_t alignment)
+		{
+			return system_alloc(size, alignment);
+		}
+
+		void backend_free(void* ptr)
+		{
+			system_free(ptr);
+		}
+
+		void* backend_realloc(void* ptr, size_t size, size_t alignment)
+		{
+			return system_realloc(ptr, size, alignment);
+		}
+	#endif
+	}
+
+#if defined(STD_EXT_TRACK_ALLOC)
+	void* alloc_aligned(size_t size, size_t alignment, const std::source_location& location)
+	{
+		return Detail::tracked_alloc(size, alignment, location);
 	}
 
 	void free_aligned(void* ptr)
 	{
-		#if defined(STD_EXT_WIN32)
-		if (nullptr != ptr)
-			_aligned_free(ptr);
-		#else
-			free(ptr);
-		#endif
+		Detail::tracked_free(ptr);
 	}
 
-	void* realloc_aligned(void* ptr, size_t size, size_t alignment)
+	void* realloc_aligned(void* ptr, size_t size, size_t alignment, const std::source_location& location)
 	{
-	#if defined(STD_EXT_WIN32)
-		if (nullptr != ptr)
-			return _aligned_realloc(ptr, size, alignment);
-
-		return nullptr;
-	#elif defined (STD_EXT_APPLE)
-		auto old_size = malloc_size(ptr);
-		void* ret = alloc_aligned(size, alignment);
-		memcpy(ret, ptr, std::min(old_size, size));
-		free(ptr);
-		
-		return ret;
-	#elif defined(STD_EXT_GCC)
-		auto old_size = malloc_usable_size(ptr);
-		void* ret = alloc_aligned(size, alignment);
-		memcpy(ret, ptr, std::min(old_size, size));
-		free(ptr);
-
-		return ret;
-	#endif
+		return Detail::tracked_realloc(ptr, size, alignment, location);
+	}
+#else
+	void* alloc_aligned(size_t size, size_t alignment, const std::source_location&)
+	{
+		return Detail::backend_alloc(size, alignment);
+	}
+
+	void free_aligned(void* ptr)
+	{
+		Detail::backend_free(ptr);
 	}
-}
\ No newline at end of file
+
+	void* realloc_aligned(void* ptr, size_t size, size_t alignment, const std::source_location&)
+	{
+		return Detail::backend_realloc(ptr, size, alignment);
+	}
+#endif
+}
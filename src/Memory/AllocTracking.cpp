@@ -0,0 +1,455 @@
+#include <StdExt/Memory/AllocTracking.h>
+
+#include <StdExt/Memory/Alignment.h>
+
+#include "SlabPool.h"
+#include "ThreadLocal.h"
+
+#if defined(STD_EXT_TRACK_ALLOC)
+#	include <algorithm>
+#	include <atomic>
+#	include <bit>
+#	include <cstring>
+#	include <functional>
+#	include <memory>
+#	include <mutex>
+#	include <new>
+#endif
+
+namespace StdExt
+{
+#if defined(STD_EXT_TRACK_ALLOC)
+	namespace
+	{
+		using Detail::LocalCounter;
+
+		/*
+		 * Every tracked allocation is preceded by a Header recording its size and the
+		 * index of its call site, so a block freed on any thread is attributed to the site
+		 * that allocated it.  Counters are kept per thread and written only by the owning
+		 * thread.  Live bytes are the exception, kept in one shared atomic so the
+		 * high-water mark sees every allocation, and the peak is only written when it
+		 * rises.
+		 *
+		 * Call sites are registered in a fixed table the first time any thread sees them,
+		 * and each thread caches the index of the sites it has used, so the table is only
+		 * locked on the first use of a site by a thread.  Sites that do not fit in the
+		 * cache of a thread are counted in site 0 instead of locking the table on each
+		 * call.
+		 */
+
+		constexpr size_t HeaderSize = 16;
+		constexpr uint32_t MaxSites = 1024;
+		constexpr size_t SiteCacheSize = 256;
+		constexpr size_t SiteCacheProbes = 8;
+
+		struct alignas(HeaderSize) Header
+		{
+			size_t size;
+			uint32_t site;
+			uint32_t offset;
+		};
+
+		static_assert(sizeof(Header) == HeaderSize);
+
+		Header* headerOf(void* ptr)
+		{
+			return reinterpret_cast<Header*>(static_cast<std::byte*>(ptr) - HeaderSize);
+		}
+
+		struct SiteCounters
+		{
+			LocalCounter allocations;
+			LocalCounter deallocations;
+			LocalCounter bytesAllocated;
+			LocalCounter bytesFreed;
+		};
+
+		struct CachedSite
+		{
+			const char* file = nullptr;
+			const char* function = nullptr;
+			uint32_t line = 0;
+			uint32_t site = 0;
+		};
+
+		struct ThreadCounters
+		{
+			LocalCounter allocations;
+			LocalCounter deallocations;
+			LocalCounter reallocations;
+			LocalCounter bytesAllocated;
+
+			LocalCounter sizeHistogram[AllocSizeBuckets];
+			SiteCounters sites[MaxSites];
+
+			CachedSite siteCache[SiteCacheSize];
+
+			void addTo(ThreadCounters& totals) const
+			{
+				totals.allocations.add(allocations.value());
+				totals.deallocations.add(deallocations.value());
+				totals.reallocations.add(reallocations.value());
+				totals.bytesAllocated.add(bytesAllocated.value());
+
+				for (size_t i = 0; i < AllocSizeBuckets; ++i)
+					totals.sizeHistogram[i].add(sizeHistogram[i].value());
+
+				for (size_t i = 0; i < MaxSites; ++i)
+				{
+					totals.sites[i].allocations.add(sites[i].allocations.value());
+					totals.sites[i].deallocations.add(sites[i].deallocations.value());
+					totals.sites[i].bytesAllocated.add(sites[i].bytesAllocated.value());
+					totals.sites[i].bytesFreed.add(sites[i].bytesFreed.value());
+				}
+			}
+		};
+
+		struct Site
+		{
+			const char* file;
+			const char* function;
+			uint32_t line;
+		};
+
+		/**
+		 * @brief
+		 *  The call site table and the counters of all threads.  Like the pool, it is never
+		 *  destroyed, since tracked memory can be freed during static destruction.
+		 */
+		struct Tracker
+		{
+			std::mutex lock;
+
+			Site sites[MaxSites]{};
+			uint32_t siteCount = 1;
+
+			std::vector<ThreadCounters*> threads;
+
+			/**
+			 * @brief
+			 *  Counters of threads that have exited, and of calls made by a thread after
+			 *  its own counters were destroyed.  Only accessed with the lock held.
+			 */
+			ThreadCounters retired;
+
+			std::atomic<size_t> liveBytes = 0;
+			std::atomic<size_t> peakBytes = 0;
+		};
+
+		Tracker& tracker()
+		{
+			static Tracker* instance = new Tracker();
+			return *instance;
+		}
+
+		/**
+		 * @brief
+		 *  Registers heap allocated counters for a thread, which are too large to keep in
+		 *  thread local storage, and retires them when the thread exits.
+		 */
+		struct ThreadRegistration
+		{
+			ThreadCounters* counters;
+
+			ThreadRegistration()
+				: counters(new ThreadCounters())
+			{
+				Tracker& track = tracker();
+
+				std::lock_guard lock(track.lock);
+				track.threads.push_back(counters);
+			}
+
+			~ThreadRegistration()
+			{
+				Tracker& track = tracker();
+
+				{
+					std::lock_guard lock(track.lock);
+
+					counters->addTo(track.retired);
+					std::erase(track.threads, counters);
+				}
+
+				delete counters;
+			}
+		};
+
+		ThreadCounters* threadCounters()
+		{
+			ThreadRegistration* registration = Detail::ThreadLocal<ThreadRegistration>::get();
+			return registration ? registration->counters : nullptr;
+		}
+
+		/**
+		 * @brief
+		 *  Calls func with counters, which are those of the calling thread, or with the
+		 *  retired counters if counters is null because the thread's own counters have
+		 *  been destroyed.
+		 */
+		template<typename func_t>
+		void updateCounters(ThreadCounters* counters, const func_t& func)
+		{
+			if ( counters )
+			{
+				func(*counters);
+				return;
+			}
+
+			Tracker& track = tracker();
+			std::lock_guard lock(track.lock);
+
+			func(track.retired);
+		}
+
+		uint32_t registerSite(const std::source_location& location)
+		{
+			Tracker& track = tracker();
+			std::lock_guard lock(track.lock);
+
+			for (uint32_t i = 1; i < track.siteCount; ++i)
+			{
+				const Site& site = track.sites[i];
+
+				if ( site.line == location.line() &&
+				     0 == strcmp(site.file, location.file_name()) &&
+				     0 == strcmp(site.function, location.function_name()) )
+				{
+					return i;
+				}
+			}
+
+			if ( track.siteCount == MaxSites )
+				return 0;
+
+			track.sites[track.siteCount] = Site{ location.file_name(), location.function_name(), location.line() };
+			return track.siteCount++;
+		}
+
+		uint32_t siteIndex(ThreadCounters* counters, const std::source_location& location)
+		{
+			if ( nullptr == counters )
+				return 0;
+
+			size_t hash = std::hash<const void*>{}(location.file_name()) ^ (location.line() * 0x9E3779B1u);
+
+			for (size_t probe = 0; probe < SiteCacheProbes; ++probe)
+			{
+				CachedSite& cached = counters->siteCache[(hash + probe) % SiteCacheSize];
+
+				if ( cached.file == location.file_name() && cached.line == location.line() &&
+				     cached.function == location.function_name() )
+				{
+					return cached.site;
+				}
+
+				if ( nullptr == cached.file )
+				{
+					cached = CachedSite{ location.file_name(), location.function_name(), location.line(), registerSite(location) };
+					return cached.site;
+				}
+			}
+
+			return 0;
+		}
+
+		size_t sizeBucket(size_t size)
+		{
+			return std::min<size_t>(std::bit_width(size), AllocSizeBuckets - 1);
+		}
+
+		void addLiveBytes(size_t size)
+		{
+			Tracker& track = tracker();
+
+			size_t live = track.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+			size_t peak = track.peakBytes.load(std::memory_order_relaxed);
+
+			while ( live > peak && !track.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed) )
+				;
+		}
+
+		void subtractLiveBytes(size_t size)
+		{
+			tracker().liveBytes.fetch_sub(size, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief
+		 *  The bytes placed before an allocation of the alignment, which hold the Header
+		 *  and keep the allocation aligned.
+		 */
+		size_t prefixSize(size_t alignment)
+		{
+			return std::max(alignment, HeaderSize);
+		}
+
+		void* writeHeader(void* block, size_t size, size_t alignment, uint32_t site)
+		{
+			size_t offset = prefixSize(alignment);
+			void* ptr = static_cast<std::byte*>(block) + offset;
+
+			*headerOf(ptr) = Header{ size, site, static_cast<uint32_t>(offset) };
+			return ptr;
+		}
+	}
+
+	namespace Detail
+	{
+		void* tracked_alloc(size_t size, size_t alignment, const std::source_location& location)
+		{
+			if ( 0 == size )
+				return nullptr;
+
+			void* block = backend_alloc(size + prefixSize(alignment), std::max(alignment, HeaderSize));
+
+			if ( nullptr == block )
+				return nullptr;
+
+			ThreadCounters* thread_counters = threadCounters();
+			uint32_t site = siteIndex(thread_counters, location);
+			size_t bucket = sizeBucket(size);
+
+			updateCounters(thread_counters,
+				[&](ThreadCounters& counters)
+				{
+					counters.allocations.add(1);
+					counters.bytesAllocated.add(size);
+					counters.sizeHistogram[bucket].add(1);
+					counters.sites[site].allocations.add(1);
+					counters.sites[site].bytesAllocated.add(size);
+				}
+			);
+
+			addLiveBytes(size);
+
+			return writeHeader(block, size, alignment, site);
+		}
+
+		void tracked_free(void* ptr)
+		{
+			if ( nullptr == ptr )
+				return;
+
+			Header header = *headerOf(ptr);
+
+			updateCounters(threadCounters(),
+				[&](ThreadCounters& counters)
+				{
+					counters.deallocations.add(1);
+					counters.sites[header.site].deallocations.add(1);
+					counters.sites[header.site].bytesFreed.add(header.size);
+				}
+			);
+
+			subtractLiveBytes(header.size);
+			backend_free(static_cast<std::byte*>(ptr) - header.offset);
+		}
+
+		void* tracked_realloc(void* ptr, size_t size, size_t alignment, const std::source_location& location)
+		{
+			if ( nullptr == ptr )
+				return tracked_alloc(size, alignment, location);
+
+			if ( 0 == size )
+			{
+				tracked_free(ptr);
+				return nullptr;
+			}
+
+			Header old_header = *headerOf(ptr);
+			void* old_block = static_cast<std::byte*>(ptr) - old_header.offset;
+			void* block = nullptr;
+
+			if ( old_header.offset == prefixSize(alignment) )
+			{
+				block = backend_realloc(old_block, size + old_header.offset, std::max(alignment, HeaderSize));
+
+				if ( nullptr == block )
+					return nullptr;
+			}
+			else
+			{
+				block = backend_alloc(size + prefixSize(alignment), std::max(alignment, HeaderSize));
+
+				if ( nullptr == block )
+					return nullptr;
+
+				memcpy(static_cast<std::byte*>(block) + prefixSize(alignment), ptr, std::min(size, old_header.size));
+				backend_free(old_block);
+			}
+
+			ThreadCounters* thread_counters = threadCounters();
+			uint32_t site = siteIndex(thread_counters, location);
+			size_t bucket = sizeBucket(size);
+
+			updateCounters(thread_counters,
+				[&](ThreadCounters& counters)
+				{
+					counters.reallocations.add(1);
+					counters.bytesAllocated.add(size);
+					counters.sizeHistogram[bucket].add(1);
+
+					counters.sites[old_header.site].deallocations.add(1);
+					counters.sites[old_header.site].bytesFreed.add(old_header.size);
+					counters.sites[site].allocations.add(1);
+					counters.sites[site].bytesAllocated.add(size);
+				}
+			);
+
+			if ( size > old_header.size )
+				addLiveBytes(size - old_header.size);
+			else
+				subtractLiveBytes(old_header.size - size);
+
+			return writeHeader(block, size, alignment, site);
+		}
+	}
+#endif
+
+	AllocTrackingStats alloc_tracking_stats()
+	{
+		AllocTrackingStats stats;
+
+	#if defined(STD_EXT_TRACK_ALLOC)
+		Tracker& track = tracker();
+		std::lock_guard lock(track.lock);
+
+		auto totals = std::make_unique<ThreadCounters>();
+		track.retired.addTo(*totals);
+
+		for (const ThreadCounters* counters : track.threads)
+			counters->addTo(*totals);
+
+		stats.allocations = totals->allocations.value();
+		stats.deallocations = totals->deallocations.value();
+		stats.reallocations = totals->reallocations.value();
+		stats.bytesAllocated = totals->bytesAllocated.value();
+		stats.liveBytes = track.liveBytes.load(std::memory_order_relaxed);
+		stats.peakBytes = track.peakBytes.load(std::memory_order_relaxed);
+
+		for (size_t i = 0; i < AllocSizeBuckets; ++i)
+			stats.sizeHistogram[i] = totals->sizeHistogram[i].value();
+
+		for (uint32_t i = 0; i < track.siteCount; ++i)
+		{
+			const SiteCounters& counters = totals->sites[i];
+
+			if ( 0 == i && 0 == counters.allocations.value() )
+				continue;
+
+			AllocSiteStats& site = stats.sites.emplace_back();
+			site.file = track.sites[i].file;
+			site.function = track.sites[i].function;
+			site.line = track.sites[i].line;
+			site.allocations = counters.allocations.value();
+			site.deallocations = counters.deallocations.value();
+			site.bytesAllocated = counters.bytesAllocated.value();
+			site.bytesFreed = counters.bytesFreed.value();
+		}
+	#endif
+
+		return stats;
+	}
+}
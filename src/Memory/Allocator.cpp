@@ -0,0 +1,40 @@
+#include <StdExt/Memory/Allocator.h>
+
+#include <StdExt/Memory/Alignment.h>
+
+#include <new>
+
+namespace StdExt
+{
+	namespace
+	{
+		class HeapAllocator final : public Allocator
+		{
+		public:
+			void* allocate(size_t size, size_t alignment) override
+			{
+				void* ret = alloc_aligned(size, alignment);
+
+				if ( nullptr == ret && size > 0 )
+					throw std::bad_alloc();
+
+				return ret;
+			}
+
+			void deallocate(void* ptr, [[maybe_unused]] size_t size, [[maybe_unused]] size_t alignment) noexcept override
+			{
+				free_aligned(ptr);
+			}
+		};
+	}
+
+	Allocator::~Allocator()
+	{
+	}
+
+	Allocator& Allocator::heap() noexcept
+	{
+		static HeapAllocator allocator;
+		return allocator;
+	}
+}
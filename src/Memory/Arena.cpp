@@ -0,0 +1,136 @@
+#include <StdExt/Memory/Arena.h>
+
+#include <StdExt/Memory/Alignment.h>
+#include <StdExt/Utility.h>
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace StdExt
+{
+	/**
+	 * @internal
+	 * @brief
+	 *  Header at the start of each block, linking it to the block allocated before it.
+	 */
+	struct alignas(std::max_align_t) MonotonicArena::Block
+	{
+		Block* previous;
+		size_t size;
+	};
+
+	MonotonicArena::MonotonicArena(size_t block_size)
+		: mBlocks(nullptr), mCurrent(nullptr), mEnd(nullptr),
+		  mInitialBlockSize(std::max(block_size, sizeof(Block))), mNextBlockSize(mInitialBlockSize),
+		  mBytesUsed(0), mCapacity(0)
+	{
+	}
+
+	MonotonicArena::~MonotonicArena()
+	{
+		release();
+	}
+
+	void* MonotonicArena::allocate(size_t size, size_t alignment)
+	{
+		void* ptr = mCurrent;
+		size_t space = mEnd - mCurrent;
+
+		if ( nullptr == mCurrent || nullptr == std::align(alignment, size, ptr, space) )
+		{
+			addBlock(size, alignment);
+
+			ptr = mCurrent;
+			space = mEnd - mCurrent;
+			std::align(alignment, size, ptr, space);
+		}
+
+		mCurrent = static_cast<std::byte*>(ptr) + size;
+		mBytesUsed += size;
+
+		return ptr;
+	}
+
+	void MonotonicArena::deallocate(void* ptr, size_t size, [[maybe_unused]] size_t alignment) noexcept
+	{
+		if ( static_cast<std::byte*>(ptr) + size == mCurrent )
+		{
+			mCurrent = static_cast<std::byte*>(ptr);
+			mBytesUsed -= size;
+		}
+	}
+
+	void MonotonicArena::release() noexcept
+	{
+		while ( mBlocks )
+			free_aligned( std::exchange(mBlocks, mBlocks->previous) );
+
+		mCurrent = nullptr;
+		mEnd = nullptr;
+		mNextBlockSize = mInitialBlockSize;
+		mBytesUsed = 0;
+		mCapacity = 0;
+	}
+
+	void MonotonicArena::reset() noexcept
+	{
+		if ( nullptr == mBlocks )
+			return;
+
+		Block* largest = mBlocks;
+
+		for (Block* block = mBlocks->previous; nullptr != block; block = block->previous)
+		{
+			if ( block->size > largest->size )
+				largest = block;
+		}
+
+		while ( mBlocks )
+		{
+			Block* block = std::exchange(mBlocks, mBlocks->previous);
+
+			if ( block != largest )
+				free_aligned(block);
+		}
+
+		largest->previous = nullptr;
+		mBlocks = largest;
+
+		mCurrent = reinterpret_cast<std::byte*>(mBlocks + 1);
+		mEnd = reinterpret_cast<std::byte*>(mBlocks) + mBlocks->size;
+		mBytesUsed = 0;
+		mCapacity = mBlocks->size;
+	}
+
+	size_t MonotonicArena::bytesUsed() const noexcept
+	{
+		return mBytesUsed;
+	}
+
+	size_t MonotonicArena::capacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	void MonotonicArena::addBlock(size_t size, size_t alignment)
+	{
+		size_t block_size = nextMultipleOf<size_t>(
+			std::max(mNextBlockSize, sizeof(Block) + size + alignment - 1),
+			alignof(Block)
+		);
+
+		void* allocation = alloc_aligned(block_size, alignof(Block));
+
+		if ( nullptr == allocation )
+			throw std::bad_alloc();
+
+		mBlocks = new (allocation) Block{ mBlocks, block_size };
+		mCurrent = reinterpret_cast<std::byte*>(mBlocks + 1);
+		mEnd = reinterpret_cast<std::byte*>(mBlocks) + block_size;
+		mCapacity += block_size;
+
+		mNextBlockSize = std::min(2 * mNextBlockSize, std::max(MaxBlockSize, mInitialBlockSize));
+	}
+}
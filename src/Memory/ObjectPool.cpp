@@ -0,0 +1,352 @@
+#include <StdExt/Memory/ObjectPool.h>
+
+#include <StdExt/Utility.h>
+
+#include "ThreadLocal.h"
+
+#include <bit>
+#include <exception>
+#include <vector>
+
+namespace StdExt::Detail
+{
+	struct ObjectPoolBase::Magazine
+	{
+		/**
+		 * @brief
+		 *  One more than the index of the next magazine in a shared stack, or zero for
+		 *  the bottom of the stack.
+		 */
+		std::atomic<uint32_t> next;
+
+		uint32_t index;
+		uint32_t count;
+
+		void* slots[MagazineSize];
+	};
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Header at the start of each chunk of slots, linking it to the chunk allocated before it.
+	 */
+	struct alignas(std::max_align_t) ObjectPoolBase::Chunk
+	{
+		Chunk* previous;
+	};
+
+	namespace
+	{
+		/*
+		 * Pools are registered by a small index so each thread can find its magazine for
+		 * a pool in a vector.  Indexes are reused after a pool is destroyed, so the entry of
+		 * a thread also records the serial number of the pool it was made for, which is
+		 * never reused.  An entry with a stale serial belongs to a destroyed pool and is
+		 * simply replaced, since its magazine was freed with that pool.
+		 */
+
+		struct Registry
+		{
+			std::mutex mutex;
+			std::vector<ObjectPoolBase*> pools;
+			std::vector<uint64_t> serials;
+			std::vector<size_t> freeIndexes;
+			uint64_t nextSerial = 1;
+		};
+
+		/**
+		 * @brief
+		 *  The registry is never destroyed so it remains available to threads that exit
+		 *  during static destruction.
+		 */
+		Registry& registry()
+		{
+			static Registry* instance = new Registry();
+			return *instance;
+		}
+
+		struct ThreadEntry
+		{
+			uint64_t serial = 0;
+			void* magazine = nullptr;
+		};
+
+		/**
+		 * @brief
+		 *  The magazines of a thread for each pool, which are returned to their pools when
+		 *  the thread exits.
+		 */
+		struct ThreadEntries
+		{
+			std::vector<ThreadEntry> entries;
+
+			~ThreadEntries()
+			{
+				Registry& reg = registry();
+				std::lock_guard lock(reg.mutex);
+
+				for (size_t index = 0; index < entries.size(); ++index)
+				{
+					const ThreadEntry& entry = entries[index];
+
+					if ( entry.magazine && index < reg.serials.size() && reg.serials[index] == entry.serial )
+						reg.pools[index]->returnMagazine(entry.magazine);
+				}
+			}
+		};
+
+		ThreadEntries* threadEntries() noexcept
+		{
+			return ThreadLocal<ThreadEntries>::get();
+		}
+
+		constexpr uint64_t packHead(uint32_t next, uint32_t tag)
+		{
+			return (static_cast<uint64_t>(tag) << 32) | next;
+		}
+
+		constexpr uint32_t headNext(uint64_t head)
+		{
+			return static_cast<uint32_t>(head);
+		}
+
+		constexpr uint32_t headTag(uint64_t head)
+		{
+			return static_cast<uint32_t>(head >> 32);
+		}
+	}
+
+	ObjectPoolBase::ObjectPoolBase(size_t slot_size, size_t slot_alignment)
+		: mSlotSize(nextMultipleOf(slot_size, slot_alignment)), mSlotAlignment(slot_alignment),
+		  mSerial(0), mIndex(0), mFullMagazines(0), mEmptyMagazines(0), mMagazineBlocks{},
+		  mMagazineCount(0), mChunks(nullptr), mCarve(nullptr), mCarveEnd(nullptr),
+		  mNextChunkSlots(MagazineSize), mCapacity(0), mShared(nullptr)
+	{
+		Registry& reg = registry();
+		std::lock_guard lock(reg.mutex);
+
+		mSerial = reg.nextSerial++;
+
+		if ( reg.freeIndexes.empty() )
+		{
+			mIndex = reg.pools.size();
+			reg.pools.push_back(this);
+			reg.serials.push_back(mSerial);
+		}
+		else
+		{
+			mIndex = reg.freeIndexes.back();
+			reg.freeIndexes.pop_back();
+
+			reg.pools[mIndex] = this;
+			reg.serials[mIndex] = mSerial;
+		}
+	}
+
+	ObjectPoolBase::~ObjectPoolBase()
+	{
+		{
+			Registry& reg = registry();
+			std::lock_guard lock(reg.mutex);
+
+			reg.pools[mIndex] = nullptr;
+			reg.serials[mIndex] = 0;
+			reg.freeIndexes.push_back(mIndex);
+		}
+
+		while ( mChunks )
+			free_aligned( std::exchange(mChunks, mChunks->previous) );
+
+		for ( auto& block : mMagazineBlocks )
+			free_aligned( block.load(std::memory_order_relaxed) );
+	}
+
+	void* ObjectPoolBase::allocateSlot()
+	{
+		if ( Magazine** local = localMagazine() )
+			return allocateFrom(*local);
+
+		std::lock_guard lock(mSharedMutex);
+		return allocateFrom(mShared);
+	}
+
+	void ObjectPoolBase::freeSlot(void* slot) noexcept
+	{
+		if ( Magazine** local = localMagazine() )
+		{
+			freeTo(*local, slot);
+			return;
+		}
+
+		std::lock_guard lock(mSharedMutex);
+		freeTo(mShared, slot);
+	}
+
+	size_t ObjectPoolBase::capacity() const noexcept
+	{
+		return mCapacity.load(std::memory_order_relaxed);
+	}
+
+	void ObjectPoolBase::returnMagazine(void* magazine) noexcept
+	{
+		Magazine* returned = static_cast<Magazine*>(magazine);
+		push( (returned->count > 0) ? mFullMagazines : mEmptyMagazines, returned );
+	}
+
+	ObjectPoolBase::Magazine** ObjectPoolBase::localMagazine() noexcept
+	{
+		ThreadEntries* thread_entries = threadEntries();
+
+		if ( nullptr == thread_entries )
+			return nullptr;
+
+		std::vector<ThreadEntry>& entries = thread_entries->entries;
+
+		if ( entries.size() <= mIndex )
+			entries.resize(mIndex + 1);
+
+		ThreadEntry& entry = entries[mIndex];
+
+		if ( entry.serial != mSerial )
+		{
+			entry.serial = mSerial;
+			entry.magazine = takeEmptyMagazine();
+		}
+
+		return reinterpret_cast<Magazine**>(&entry.magazine);
+	}
+
+	void* ObjectPoolBase::allocateFrom(Magazine*& magazine)
+	{
+		if ( nullptr == magazine )
+			magazine = takeEmptyMagazine();
+
+		if ( 0 == magazine->count )
+		{
+			if ( Magazine* full = pop(mFullMagazines) )
+				push(mEmptyMagazines, std::exchange(magazine, full));
+			else
+				fill(magazine);
+		}
+
+		return magazine->slots[--magazine->count];
+	}
+
+	void ObjectPoolBase::freeTo(Magazine*& magazine, void* slot) noexcept
+	{
+		if ( nullptr == magazine )
+		{
+			magazine = takeEmptyMagazine();
+		}
+		else if ( MagazineSize == magazine->count )
+		{
+			push(mFullMagazines, magazine);
+			magazine = takeEmptyMagazine();
+		}
+
+		magazine->slots[magazine->count++] = slot;
+	}
+
+	void ObjectPoolBase::push(std::atomic<uint64_t>& stack, Magazine* magazine) noexcept
+	{
+		uint64_t head = stack.load(std::memory_order_relaxed);
+		uint64_t desired;
+
+		do
+		{
+			magazine->next.store(headNext(head), std::memory_order_relaxed);
+			desired = packHead(magazine->index + 1, headTag(head) + 1);
+		}
+		while ( !stack.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed) );
+	}
+
+	ObjectPoolBase::Magazine* ObjectPoolBase::pop(std::atomic<uint64_t>& stack) noexcept
+	{
+		uint64_t head = stack.load(std::memory_order_acquire);
+
+		while ( 0 != headNext(head) )
+		{
+			Magazine* magazine = magazineAt(headNext(head) - 1);
+			uint64_t desired = packHead(magazine->next.load(std::memory_order_relaxed), headTag(head) + 1);
+
+			if ( stack.compare_exchange_weak(head, desired, std::memory_order_acquire, std::memory_order_acquire) )
+				return magazine;
+		}
+
+		return nullptr;
+	}
+
+	ObjectPoolBase::Magazine* ObjectPoolBase::magazineAt(uint32_t index) const noexcept
+	{
+		// Block k holds FirstMagazineBlockSize << k magazines.
+		size_t block = std::bit_width(index / FirstMagazineBlockSize + 1) - 1;
+		size_t first_in_block = FirstMagazineBlockSize * ((size_t(1) << block) - 1);
+
+		return mMagazineBlocks[block].load(std::memory_order_acquire) + (index - first_in_block);
+	}
+
+	ObjectPoolBase::Magazine* ObjectPoolBase::takeEmptyMagazine() noexcept
+	{
+		if ( Magazine* magazine = pop(mEmptyMagazines) )
+			return magazine;
+
+		std::lock_guard lock(mGrowthMutex);
+
+		uint32_t index = mMagazineCount;
+		size_t block = std::bit_width(index / FirstMagazineBlockSize + 1) - 1;
+		Magazine* block_start = mMagazineBlocks[block].load(std::memory_order_relaxed);
+
+		if ( nullptr == block_start )
+		{
+			size_t block_size = FirstMagazineBlockSize << block;
+			block_start = static_cast<Magazine*>(alloc_aligned(block_size * sizeof(Magazine), alignof(Magazine)));
+
+			// There is no way to report failure from freeSlot().
+			if ( nullptr == block_start )
+				std::terminate();
+
+			mMagazineBlocks[block].store(block_start, std::memory_order_release);
+		}
+
+		Magazine* magazine = magazineAt(index);
+		new (magazine) Magazine{ {0}, index, 0, {} };
+		++mMagazineCount;
+
+		return magazine;
+	}
+
+	void ObjectPoolBase::fill(Magazine* magazine)
+	{
+		std::lock_guard lock(mGrowthMutex);
+
+		while ( magazine->count < MagazineSize )
+		{
+			if ( mCarve == mCarveEnd )
+			{
+				size_t header_size = nextMultipleOf(sizeof(Chunk), mSlotAlignment);
+				size_t chunk_alignment = std::max(mSlotAlignment, alignof(Chunk));
+				size_t chunk_size = header_size + mNextChunkSlots * mSlotSize;
+
+				void* allocation = alloc_aligned(chunk_size, chunk_alignment);
+
+				if ( nullptr == allocation )
+				{
+					if ( magazine->count > 0 )
+						return;
+
+					throw std::bad_alloc();
+				}
+
+				mChunks = new (allocation) Chunk{ mChunks };
+				mCarve = static_cast<std::byte*>(allocation) + header_size;
+				mCarveEnd = static_cast<std::byte*>(allocation) + chunk_size;
+				mCapacity.fetch_add(mNextChunkSlots, std::memory_order_relaxed);
+
+				mNextChunkSlots = std::min(2 * mNextChunkSlots, MaxChunkSlots);
+			}
+
+			magazine->slots[magazine->count++] = mCarve;
+			mCarve += mSlotSize;
+		}
+	}
+}
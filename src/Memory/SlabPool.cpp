@@ -0,0 +1,534 @@
+#include "SlabPool.h"
+#include "ThreadLocal.h"
+
+#include <StdExt/Memory/Alignment.h>
+
+#if defined(STD_EXT_POOLED_ALLOC)
+#	include <algorithm>
+#	include <array>
+#	include <atomic>
+#	include <cstdint>
+#	include <cstring>
+#	include <mutex>
+#	include <new>
+#endif
+
+namespace StdExt
+{
+#if defined(STD_EXT_POOLED_ALLOC)
+	namespace
+	{
+		/*
+		 * Every allocation is preceded by a Header.  Blocks of up to MaxPooledSize bytes
+		 * with an alignment of up to HeaderSize are carved from slabs in size classes.
+		 * Each thread keeps a free list per size class, so pooled allocation and
+		 * deallocation do not synchronize.  A thread whose free list grows past twice
+		 * the batch size of the class returns a batch to the global free list of the
+		 * class, and threads with an empty free list take a batch from it before carving
+		 * new blocks.  Slabs are kept for the life of the process.
+		 */
+
+		constexpr size_t HeaderSize = alignof(std::max_align_t);
+		constexpr size_t SlabSize = 64 * 1024;
+		constexpr size_t MaxPooledSize = 1024;
+		constexpr uint32_t LargeClass = UINT32_MAX;
+
+		struct alignas(HeaderSize) Header
+		{
+			uint32_t sizeClass;
+
+			/**
+			 * @brief
+			 *  Bytes from the start of the system allocation to the user memory.
+			 */
+			uint32_t offset;
+
+			/**
+			 * @brief
+			 *  The number of bytes usable after the header.
+			 */
+			uint64_t size;
+		};
+
+		static_assert(sizeof(Header) == HeaderSize);
+
+		/**
+		 * @brief
+		 *  A free block, overlaying its header and the start of its memory.  The first
+		 *  block of a batch links to the next batch and stores the size of its own.
+		 */
+		struct FreeBlock
+		{
+			FreeBlock* next;
+			FreeBlock* nextBatch;
+			size_t batchCount;
+		};
+
+		constexpr std::array<size_t, 20> ClassSizes =
+		{
+			16, 32, 48, 64, 80, 96, 112, 128,
+			160, 192, 224, 256,
+			320, 384, 448, 512,
+			640, 768, 896, 1024
+		};
+
+		constexpr size_t ClassCount = ClassSizes.size();
+		static_assert(ClassCount == AllocPoolStats::SizeClassCount);
+
+		constexpr size_t batchSizeFor(size_t size)
+		{
+			return std::clamp<size_t>(16 * 1024 / (size + HeaderSize), 8, 64);
+		}
+
+		/**
+		 * @brief
+		 *  Maps the size of a pooled allocation, in units of HeaderSize rounded up, to the
+		 *  smallest size class that can hold it.
+		 */
+		constexpr auto ClassLookup = []()
+		{
+			std::array<uint8_t, MaxPooledSize / HeaderSize + 1> ret{};
+			size_t size_class = 0;
+
+			for (size_t units = 0; units < ret.size(); ++units)
+			{
+				while ( ClassSizes[size_class] < units * HeaderSize )
+					++size_class;
+
+				ret[units] = static_cast<uint8_t>(size_class);
+			}
+
+			return ret;
+		}();
+
+		inline uint32_t classFor(size_t size)
+		{
+			return ClassLookup[(size + HeaderSize - 1) / HeaderSize];
+		}
+
+		inline size_t blockSize(uint32_t size_class)
+		{
+			return ClassSizes[size_class] + HeaderSize;
+		}
+
+		inline Header* headerOf(void* ptr)
+		{
+			return reinterpret_cast<Header*>(static_cast<std::byte*>(ptr) - HeaderSize);
+		}
+
+		inline void* memoryOf(void* block)
+		{
+			return static_cast<std::byte*>(block) + HeaderSize;
+		}
+
+		struct ThreadCache;
+
+		struct GlobalClass
+		{
+			std::mutex lock;
+			FreeBlock* batches = nullptr;
+		};
+
+		/**
+		 * @brief
+		 *  State shared by all threads.  It is never destroyed, so memory can still be
+		 *  freed while other static and thread local objects are destroyed.
+		 */
+		struct GlobalPool
+		{
+			std::array<GlobalClass, ClassCount> classes;
+
+			std::mutex slabLock;
+			void* slabs = nullptr;
+
+			std::mutex threadLock;
+			ThreadCache* threads = nullptr;
+
+			std::atomic<size_t> retiredAllocations = 0;
+			std::atomic<size_t> retiredDeallocations = 0;
+			std::atomic<size_t> largeAllocations = 0;
+			std::atomic<size_t> largeDeallocations = 0;
+			std::atomic<size_t> slabCount = 0;
+			std::atomic<size_t> batchTransfers = 0;
+
+			void pushBatch(uint32_t size_class, FreeBlock* batch)
+			{
+				batchTransfers.fetch_add(1, std::memory_order_relaxed);
+
+				std::lock_guard guard(classes[size_class].lock);
+				batch->nextBatch = classes[size_class].batches;
+				classes[size_class].batches = batch;
+			}
+
+			FreeBlock* popBatch(uint32_t size_class)
+			{
+				FreeBlock* batch = nullptr;
+
+				{
+					std::lock_guard guard(classes[size_class].lock);
+					batch = classes[size_class].batches;
+
+					if ( batch )
+						classes[size_class].batches = batch->nextBatch;
+				}
+
+				if ( batch )
+					batchTransfers.fetch_add(1, std::memory_order_relaxed);
+
+				return batch;
+			}
+
+			/**
+			 * @brief
+			 *  Allocates a slab, returning the memory after the link to the previous slab.
+			 */
+			std::byte* allocateSlab()
+			{
+				void* slab = Detail::system_alloc(SlabSize, HeaderSize);
+
+				if ( nullptr == slab )
+					throw std::bad_alloc();
+
+				{
+					std::lock_guard guard(slabLock);
+
+					*static_cast<void**>(slab) = slabs;
+					slabs = slab;
+				}
+
+				slabCount.fetch_add(1, std::memory_order_relaxed);
+				return static_cast<std::byte*>(slab) + HeaderSize;
+			}
+		};
+
+		GlobalPool& globalPool()
+		{
+			static GlobalPool* pool = new GlobalPool();
+			return *pool;
+		}
+
+		struct ThreadCache
+		{
+			struct ClassCache
+			{
+				FreeBlock* head = nullptr;
+				size_t count = 0;
+
+				std::byte* carveStart = nullptr;
+				std::byte* carveEnd = nullptr;
+			};
+
+			std::array<ClassCache, ClassCount> classes;
+
+			Detail::LocalCounter allocations;
+			Detail::LocalCounter deallocations;
+
+			ThreadCache* previous = nullptr;
+			ThreadCache* next = nullptr;
+
+			ThreadCache()
+			{
+				GlobalPool& pool = globalPool();
+				std::lock_guard guard(pool.threadLock);
+
+				next = pool.threads;
+
+				if ( next )
+					next->previous = this;
+
+				pool.threads = this;
+			}
+
+			/**
+			 * @brief
+			 *  Returns all free blocks of the thread, including those not yet carved from
+			 *  its slabs, to the global free lists.
+			 */
+			~ThreadCache()
+			{
+				GlobalPool& pool = globalPool();
+
+				for (uint32_t size_class = 0; size_class < ClassCount; ++size_class)
+				{
+					ClassCache& cache = classes[size_class];
+					size_t block_size = blockSize(size_class);
+
+					while ( static_cast<size_t>(cache.carveEnd - cache.carveStart) >= block_size )
+					{
+						push(size_class, reinterpret_cast<FreeBlock*>(cache.carveStart));
+						cache.carveStart += block_size;
+					}
+
+					if ( cache.head )
+					{
+						cache.head->batchCount = cache.count;
+						pool.pushBatch(size_class, cache.head);
+					}
+				}
+
+				std::lock_guard guard(pool.threadLock);
+
+				if ( previous )
+					previous->next = next;
+				else
+					pool.threads = next;
+
+				if ( next )
+					next->previous = previous;
+
+				pool.retiredAllocations.fetch_add(allocations.value(), std::memory_order_relaxed);
+				pool.retiredDeallocations.fetch_add(deallocations.value(), std::memory_order_relaxed);
+			}
+
+			void* allocate(uint32_t size_class)
+			{
+				ClassCache& cache = classes[size_class];
+				FreeBlock* block = cache.head;
+
+				if ( block )
+				{
+					cache.head = block->next;
+					--cache.count;
+				}
+				else
+				{
+					block = refill(size_class);
+				}
+
+				Header* header = reinterpret_cast<Header*>(block);
+				header->sizeClass = size_class;
+				header->offset = HeaderSize;
+				header->size = ClassSizes[size_class];
+
+				allocations.increment();
+				return memoryOf(block);
+			}
+
+			void deallocate(Header* header)
+			{
+				push(header->sizeClass, reinterpret_cast<FreeBlock*>(header));
+				deallocations.increment();
+			}
+
+		private:
+			void push(uint32_t size_class, FreeBlock* block)
+			{
+				ClassCache& cache = classes[size_class];
+
+				block->next = cache.head;
+				cache.head = block;
+
+				size_t batch_size = batchSizeFor(ClassSizes[size_class]);
+
+				if ( ++cache.count >= 2 * batch_size )
+				{
+					FreeBlock* batch = cache.head;
+					FreeBlock* last = batch;
+
+					for (size_t i = 1; i < batch_size; ++i)
+						last = last->next;
+
+					cache.head = last->next;
+					cache.count -= batch_size;
+
+					last->next = nullptr;
+					batch->batchCount = batch_size;
+
+					globalPool().pushBatch(size_class, batch);
+				}
+			}
+
+			/**
+			 * @brief
+			 *  Gets a block when the free list of the class is empty, taking a batch from
+			 *  the global free list, or carving one from a slab.
+			 */
+			FreeBlock* refill(uint32_t size_class)
+			{
+				ClassCache& cache = classes[size_class];
+
+				if ( FreeBlock* batch = globalPool().popBatch(size_class) )
+				{
+					cache.head = batch->next;
+					cache.count = batch->batchCount - 1;
+
+					return batch;
+				}
+
+				size_t block_size = blockSize(size_class);
+
+				if ( static_cast<size_t>(cache.carveEnd - cache.carveStart) < block_size )
+				{
+					cache.carveStart = globalPool().allocateSlab();
+					cache.carveEnd = cache.carveStart + (SlabSize - HeaderSize);
+				}
+
+				FreeBlock* block = reinterpret_cast<FreeBlock*>(cache.carveStart);
+				cache.carveStart += block_size;
+
+				return block;
+			}
+		};
+
+		/*
+		 * After the cache of a thread is destroyed, its allocations are made by the
+		 * system allocator, and its pooled deallocations go directly to the global free
+		 * lists.
+		 */
+		ThreadCache* threadCache()
+		{
+			return Detail::ThreadLocal<ThreadCache>::get();
+		}
+
+		void* allocateLarge(size_t size, size_t alignment)
+		{
+			size_t offset = std::max(alignment, HeaderSize);
+			void* allocation = Detail::system_alloc(size + offset, offset);
+
+			if ( nullptr == allocation )
+				return nullptr;
+
+			void* ret = static_cast<std::byte*>(allocation) + offset;
+
+			Header* header = headerOf(ret);
+			header->sizeClass = LargeClass;
+			header->offset = static_cast<uint32_t>(offset);
+			header->size = size;
+
+			globalPool().largeAllocations.fetch_add(1, std::memory_order_relaxed);
+			return ret;
+		}
+
+		bool isPooled(size_t size, size_t alignment)
+		{
+			return (size <= MaxPooledSize && alignment <= HeaderSize);
+		}
+	}
+
+	namespace Detail
+	{
+		void* pool_alloc(size_t size, size_t alignment)
+		{
+			if ( 0 == size )
+				return nullptr;
+
+			if ( isPooled(size, alignment) )
+			{
+				if ( ThreadCache* cache = threadCache() )
+					return cache->allocate(classFor(size));
+			}
+
+			return allocateLarge(size, alignment);
+		}
+
+		void pool_free(void* ptr)
+		{
+			if ( nullptr == ptr )
+				return;
+
+			Header* header = headerOf(ptr);
+
+			if ( LargeClass == header->sizeClass )
+			{
+				globalPool().largeDeallocations.fetch_add(1, std::memory_order_relaxed);
+				system_free(static_cast<std::byte*>(ptr) - header->offset);
+			}
+			else if ( ThreadCache* cache = threadCache() )
+			{
+				cache->deallocate(header);
+			}
+			else
+			{
+				GlobalPool& pool = globalPool();
+
+				// The free block overlays the header, so read the class first.
+				uint32_t size_class = header->sizeClass;
+
+				FreeBlock* block = reinterpret_cast<FreeBlock*>(header);
+				block->next = nullptr;
+				block->batchCount = 1;
+
+				pool.pushBatch(size_class, block);
+				pool.retiredDeallocations.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		void* pool_realloc(void* ptr, size_t size, size_t alignment)
+		{
+			if ( nullptr == ptr )
+				return pool_alloc(size, alignment);
+
+			Header* header = headerOf(ptr);
+			size_t old_size = header->size;
+
+			if ( LargeClass == header->sizeClass )
+			{
+				// Large blocks with the header alignment can be resized by the system
+				// allocator, possibly in place.
+				if ( HeaderSize == header->offset && alignment <= HeaderSize && !isPooled(size, alignment) )
+				{
+					void* allocation = system_realloc(header, size + HeaderSize, HeaderSize);
+
+					if ( nullptr == allocation )
+						return nullptr;
+
+					header = static_cast<Header*>(allocation);
+					header->size = size;
+
+					return memoryOf(allocation);
+				}
+			}
+			else if ( size <= old_size && alignment <= HeaderSize )
+			{
+				return ptr;
+			}
+
+			void* ret = pool_alloc(size, alignment);
+
+			if ( nullptr == ret )
+				return nullptr;
+
+			std::memcpy(ret, ptr, std::min<size_t>(old_size, size));
+			pool_free(ptr);
+
+			return ret;
+		}
+	}
+#endif
+
+	AllocPoolStats alloc_pool_stats()
+	{
+		AllocPoolStats stats;
+
+	#if defined(STD_EXT_POOLED_ALLOC)
+		GlobalPool& pool = globalPool();
+
+		stats.pooledAllocations = pool.retiredAllocations.load(std::memory_order_relaxed);
+		stats.pooledDeallocations = pool.retiredDeallocations.load(std::memory_order_relaxed);
+		stats.largeAllocations = pool.largeAllocations.load(std::memory_order_relaxed);
+		stats.largeDeallocations = pool.largeDeallocations.load(std::memory_order_relaxed);
+		stats.slabCount = pool.slabCount.load(std::memory_order_relaxed);
+		stats.batchTransfers = pool.batchTransfers.load(std::memory_order_relaxed);
+
+		for (uint32_t size_class = 0; size_class < ClassCount; ++size_class)
+		{
+			stats.classSizes[size_class] = ClassSizes[size_class];
+
+			std::lock_guard guard(pool.classes[size_class].lock);
+
+			for (FreeBlock* batch = pool.classes[size_class].batches; batch; batch = batch->nextBatch)
+				stats.globalFreeBlocks[size_class] += batch->batchCount;
+		}
+
+		std::lock_guard guard(pool.threadLock);
+
+		for (ThreadCache* cache = pool.threads; cache; cache = cache->next)
+		{
+			stats.pooledAllocations += cache->allocations.value();
+			stats.pooledDeallocations += cache->deallocations.value();
+		}
+	#endif
+
+		return stats;
+	}
+}
@@ -0,0 +1,50 @@
+#ifndef _STD_EXT_SRC_MEMORY_SLAB_POOL_H_
+#define _STD_EXT_SRC_MEMORY_SLAB_POOL_H_
+
+#include <cstddef>
+#include <source_location>
+
+namespace StdExt::Detail
+{
+	/**
+	 * @internal
+	 * @brief
+	 *  Allocation directly from the platform allocator, which alloc_aligned() and
+	 *  related functions use when the pool is not enabled.
+	 */
+	void* system_alloc(size_t size, size_t alignment);
+	void system_free(void* ptr);
+	void* system_realloc(void* ptr, size_t size, size_t alignment);
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Allocation through the size-class pool, which alloc_aligned() and related
+	 *  functions use when the library is built with STD_EXT_POOLED_ALLOC.
+	 */
+	void* pool_alloc(size_t size, size_t alignment);
+	void pool_free(void* ptr);
+	void* pool_realloc(void* ptr, size_t size, size_t alignment);
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Allocation through the pool or the platform allocator, whichever the library
+	 *  was built to use.
+	 */
+	void* backend_alloc(size_t size, size_t alignment);
+	void backend_free(void* ptr);
+	void* backend_realloc(void* ptr, size_t size, size_t alignment);
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Allocation through the backend that records each call, which alloc_aligned()
+	 *  and related functions use when the library is built with STD_EXT_TRACK_ALLOC.
+	 */
+	void* tracked_alloc(size_t size, size_t alignment, const std::source_location& location);
+	void tracked_free(void* ptr);
+	void* tracked_realloc(void* ptr, size_t size, size_t alignment, const std::source_location& location);
+}
+
+#endif // !_STD_EXT_SRC_MEMORY_SLAB_POOL_H_
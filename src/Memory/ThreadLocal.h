@@ -0,0 +1,99 @@
+#ifndef _STD_EXT_SRC_MEMORY_THREAD_LOCAL_H_
+#define _STD_EXT_SRC_MEMORY_THREAD_LOCAL_H_
+
+#include <atomic>
+#include <cstddef>
+
+namespace StdExt::Detail
+{
+	/**
+	 * @internal
+	 * @brief
+	 *  Counter written only by its owning thread, and read on any thread when statistics
+	 *  are gathered.  Updates are plain loads and stores instead of atomic
+	 *  read-modify-write operations.
+	 */
+	class LocalCounter
+	{
+	public:
+		void add(size_t amount) noexcept
+		{
+			mValue.store(mValue.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief
+		 *  Subtracts amount, wrapping around zero, so counters of several threads still sum
+		 *  to the right total when one thread subtracts what another added.
+		 */
+		void subtract(size_t amount) noexcept
+		{
+			mValue.store(mValue.load(std::memory_order_relaxed) - amount, std::memory_order_relaxed);
+		}
+
+		void increment() noexcept
+		{
+			add(1);
+		}
+
+		size_t value() const noexcept
+		{
+			return mValue.load(std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<size_t> mValue = 0;
+	};
+
+	/**
+	 * @internal
+	 * @brief
+	 *  A thread local object of type T used by the allocators, created on the first call
+	 *  to get() on each thread.
+	 *
+	 * @details
+	 *  The object is reached through a pointer with constant initialization, so the common
+	 *  path does not check for thread local initialization.  The pointer is cleared before
+	 *  the object is destroyed, and get() returns nullptr from then on, so allocations made
+	 *  by the destructor of T or by other thread local objects destroyed after it must be
+	 *  handled without it.
+	 */
+	template<typename T>
+	class ThreadLocal
+	{
+	public:
+		static T* get()
+		{
+			if ( tInstance )
+				return tInstance;
+
+			if ( tDestroyed )
+				return nullptr;
+
+			thread_local Owner owner;
+			return tInstance;
+		}
+
+	private:
+		struct Owner
+		{
+			T instance;
+
+			Owner()
+			{
+				tInstance = &instance;
+			}
+
+			~Owner()
+			{
+				tInstance = nullptr;
+				tDestroyed = true;
+			}
+		};
+
+		static inline thread_local T* tInstance = nullptr;
+		static inline thread_local bool tDestroyed = false;
+	};
+}
+
+#endif // !_STD_EXT_SRC_MEMORY_THREAD_LOCAL_H_
@@ -1,14 +1,161 @@
 #include <StdExt/Number.h>
 #include <StdExt/Buffer.h>
+#include <StdExt/Format.h>
+#include <StdExt/Platform.h>
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <cerrno>
+#include <charconv>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <string>
 
+#if defined(STD_EXT_SSE2)
+#	include <emmintrin.h>
+#endif
+
 using namespace std;
 
 namespace StdExt
 {
+	namespace
+	{
+		bool isSpace(char ch) noexcept
+		{
+			return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\f' || ch == '\v';
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  The number of consecutive decimal digits at the start of [first, last).
+		 */
+		size_t countDigits(const char* first, const char* last) noexcept
+		{
+			const char* pos = first;
+
+		#if defined(STD_EXT_SSE2)
+			const __m128i zero = _mm_set1_epi8('0');
+			const __m128i nine = _mm_set1_epi8(9);
+
+			while (last - pos >= 16)
+			{
+				// Digits are the bytes that are at most 9 after subtracting '0' as unsigned.
+				__m128i offsets = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)), zero);
+				__m128i digits = _mm_cmpeq_epi8(_mm_min_epu8(offsets, nine), offsets);
+				uint32_t non_digits = ~static_cast<uint32_t>(_mm_movemask_epi8(digits)) & 0xFFFF;
+
+				if (0 != non_digits)
+					return (pos - first) + std::countr_zero(non_digits);
+
+				pos += 16;
+			}
+		#endif
+
+			while (pos < last && static_cast<unsigned char>(*pos - '0') <= 9)
+				++pos;
+
+			return pos - first;
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Converts eight ASCII digits with three multiplies instead of eight.
+		 */
+		uint64_t parseEightDigits(const char* digits) noexcept
+		{
+			uint64_t value;
+			std::memcpy(&value, digits, sizeof(uint64_t));
+
+			value = ((value & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+			value = ((value & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+
+			return ((value & 0x0000FFFF0000FFFF) * 42949672960001) >> 32;
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Accumulates <i>count</i> digits into <i>out</i>, returning false if the value
+		 *  does not fit in a uint64_t.
+		 */
+		bool parseDigits(const char* digits, size_t count, uint64_t* out) noexcept
+		{
+			while (count > 1 && '0' == *digits)
+			{
+				++digits;
+				--count;
+			}
+
+			// Any 19 digit value fits.  A 20th digit needs an overflow check.
+			if (count > 20)
+				return false;
+
+			size_t head = std::min<size_t>(count, 19);
+			uint64_t value = 0;
+			size_t i = 0;
+
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				for (; i + 8 <= head; i += 8)
+					value = value * 100000000 + parseEightDigits(digits + i);
+			}
+
+			for (; i < head; ++i)
+				value = value * 10 + (digits[i] - '0');
+
+			if (20 == count)
+			{
+				constexpr uint64_t limit = std::numeric_limits<uint64_t>::max() / 10;
+				uint64_t last_digit = digits[19] - '0';
+
+				if (value > limit || (value == limit && last_digit > std::numeric_limits<uint64_t>::max() % 10))
+					return false;
+
+				value = value * 10 + last_digit;
+			}
+
+			*out = value;
+			return true;
+		}
+
+		float64_t parseFloat(const char* first, const char* last)
+		{
+			float64_t value = 0.0;
+
+		#if defined(__cpp_lib_to_chars)
+			auto result = std::from_chars(first, last, value);
+
+			if (result.ec == std::errc::result_out_of_range)
+				throw std::out_of_range("Number is outside the range of float64_t.");
+
+			if (result.ec != std::errc() || result.ptr != last)
+				throw std::invalid_argument("Text is not a number.");
+		#else
+			// Standard libraries without floating point from_chars fall back to strtod(),
+			// which depends on the C locale.
+			std::string text(first, last);
+			char* end = nullptr;
+
+			errno = 0;
+			value = std::strtod(text.c_str(), &end);
+
+			if (end != text.c_str() + text.size())
+				throw std::invalid_argument("Text is not a number.");
+
+			if (ERANGE == errno && std::isinf(value))
+				throw std::out_of_range("Number is outside the range of float64_t.");
+		#endif
+
+			return value;
+		}
+	}
+
 
 	Number::Number()
 	{
@@ -67,52 +214,72 @@ namespace StdExt
 
 	String Number::toString() const
 	{
-		std::wstring strOut;
-		
-		if (std::holds_alternative<int64_t>(mValue))
-			strOut = std::to_wstring(std::get<int64_t>(mValue));
-		else if (std::holds_alternative<uint64_t>(mValue))
-			strOut = std::to_wstring(std::get<uint64_t>(mValue));
-		else if (std::holds_alternative<double_t>(mValue))
-			strOut = std::to_wstring(std::get<double_t>(mValue));
-		else
-			throw invalid_operation("Unknown internal numeric type.");
-
-		return convertString<char8_t>(strOut);
+		return format(u8"{}", *this);
 	}
 
 	Number Number::parse(const String& str)
 	{
-		std::wstring wstr = convertString<wchar_t>(str).toStdString();
+		return parse(str.view());
+	}
+
+	Number Number::parse(const char8_t* str)
+	{
+		return parse(std::u8string_view(str));
+	}
 
-		double parsedDouble = stod(wstr);
+	Number Number::parse(std::u8string_view str)
+	{
+		const char* first = reinterpret_cast<const char*>(str.data());
+		const char* last = first + str.size();
 
-		if (0.0 != fmod(parsedDouble, 1.0))
-		{
-			return Number(parsedDouble);
-		}
-		else if (parsedDouble >= 0.0)
+		while (first < last && isSpace(*first))
+			++first;
+
+		while (last > first && isSpace(*(last - 1)))
+			--last;
+
+		// from_chars() does not accept a leading '+', so the floating point
+		// parse starts after it.
+		bool negative = false;
+		const char* number_start = first;
+
+		if (first < last && ('-' == *first || '+' == *first))
 		{
-			try
-			{
-				return Number(stoull(wstr.data()));
-			}
-			catch (out_of_range)
-			{
-				return Number(parsedDouble);
-			}
+			negative = ('-' == *first);
+			number_start = negative ? first : first + 1;
+			++first;
 		}
-		else
+
+		if (first == last || '-' == *first || '+' == *first)
+			throw std::invalid_argument("Text is not a number.");
+
+		size_t digits = countDigits(first, last);
+
+		if (first + digits == last)
 		{
-			try
-			{
-				return Number(stoll(wstr.data()));
-			}
-			catch (out_of_range)
+			uint64_t magnitude = 0;
+
+			if (parseDigits(first, digits, &magnitude))
 			{
-				return Number(parsedDouble);
+				constexpr uint64_t int64_magnitude = uint64_t(1) << 63;
+
+				if (!negative)
+					return Number(magnitude);
+				else if (magnitude <= int64_magnitude)
+					return Number(static_cast<int64_t>(0 - magnitude));
 			}
 		}
+
+		return Number(parseFloat(number_start, last));
+	}
+
+	void Number::parse(std::span<const std::u8string_view> strings, std::span<Number> out)
+	{
+		if (strings.size() != out.size())
+			throw std::invalid_argument("Output must have one Number for each string.");
+
+		for (size_t i = 0; i < strings.size(); ++i)
+			out[i] = parse(strings[i]);
 	}
 
 	const type_info& Number::storedAsInfo() const noexcept
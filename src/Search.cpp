@@ -0,0 +1,480 @@
+#include <StdExt/Search.h>
+
+#include <StdExt/Platform.h>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(STD_EXT_SSE2)
+#	include <emmintrin.h>
+#endif
+
+#if defined(STD_EXT_SSE4_2)
+#	include <nmmintrin.h>
+#endif
+
+#if defined(STD_EXT_AVX2)
+#	include <immintrin.h>
+#endif
+
+namespace StdExt::Search
+{
+	namespace
+	{
+		constexpr size_t npos = std::string_view::npos;
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Unsigned integer type with the same size as char_t.  Searches are done on
+		 *  code units of this type so that characters of the same size share an
+		 *  implementation and compare without sign extension.
+		 */
+		template<Character char_t>
+		using unit_t = std::conditional_t<
+			sizeof(char_t) == 1, uint8_t,
+			std::conditional_t<sizeof(char_t) == 2, uint16_t, uint32_t>
+		>;
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Character sets of up to this size are searched by comparing a block of the
+		 *  string against each member of the set.  Larger sets use scalar code.
+		 */
+		constexpr size_t MaxVectorSet = 8;
+
+		/**
+		 * @internal
+		 * @brief
+		 *  The bits of a byte mask produced by movemask for a single code unit.
+		 */
+		template<typename char_t>
+		constexpr uint32_t UnitBits = (1u << sizeof(char_t)) - 1;
+
+	#if defined(STD_EXT_SSE2)
+		template<typename char_t>
+		__m128i splat128(char_t value) noexcept
+		{
+			if constexpr (sizeof(char_t) == 1)
+				return _mm_set1_epi8(static_cast<char>(value));
+			else if constexpr (sizeof(char_t) == 2)
+				return _mm_set1_epi16(static_cast<short>(value));
+			else
+				return _mm_set1_epi32(static_cast<int>(value));
+		}
+
+		template<typename char_t>
+		__m128i equal128(__m128i left, __m128i right) noexcept
+		{
+			if constexpr (sizeof(char_t) == 1)
+				return _mm_cmpeq_epi8(left, right);
+			else if constexpr (sizeof(char_t) == 2)
+				return _mm_cmpeq_epi16(left, right);
+			else
+				return _mm_cmpeq_epi32(left, right);
+		}
+
+		inline __m128i load128(const void* ptr) noexcept
+		{
+			return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+		}
+	#endif
+
+	#if defined(STD_EXT_AVX2)
+		template<typename char_t>
+		__m256i splat256(char_t value) noexcept
+		{
+			if constexpr (sizeof(char_t) == 1)
+				return _mm256_set1_epi8(static_cast<char>(value));
+			else if constexpr (sizeof(char_t) == 2)
+				return _mm256_set1_epi16(static_cast<short>(value));
+			else
+				return _mm256_set1_epi32(static_cast<int>(value));
+		}
+
+		template<typename char_t>
+		__m256i equal256(__m256i left, __m256i right) noexcept
+		{
+			if constexpr (sizeof(char_t) == 1)
+				return _mm256_cmpeq_epi8(left, right);
+			else if constexpr (sizeof(char_t) == 2)
+				return _mm256_cmpeq_epi16(left, right);
+			else
+				return _mm256_cmpeq_epi32(left, right);
+		}
+
+		inline __m256i load256(const void* ptr) noexcept
+		{
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+		}
+	#endif
+
+		template<typename char_t>
+		size_t findUnit(const char_t* str, size_t count, char_t value, size_t pos) noexcept
+		{
+			if (pos >= count)
+				return npos;
+
+			// The C library's memchr() is vectorized with the best instruction set of the
+			// host at runtime, which is at least as fast as anything compiled in here.
+			if constexpr (sizeof(char_t) == 1)
+			{
+				const void* found = memchr(str + pos, value, count - pos);
+
+				return (nullptr == found) ?
+					npos : static_cast<size_t>(static_cast<const char_t*>(found) - str);
+			}
+
+			size_t index = pos;
+
+		#if defined(STD_EXT_AVX2)
+			{
+				constexpr size_t step = sizeof(__m256i) / sizeof(char_t);
+				const __m256i needle = splat256(value);
+
+				for (; index + 4 * step <= count; index += 4 * step)
+				{
+					const __m256i found = _mm256_or_si256(
+						_mm256_or_si256(
+							equal256<char_t>(load256(str + index), needle),
+							equal256<char_t>(load256(str + index + step), needle)
+						),
+						_mm256_or_si256(
+							equal256<char_t>(load256(str + index + 2 * step), needle),
+							equal256<char_t>(load256(str + index + 3 * step), needle)
+						)
+					);
+
+					if (0 != _mm256_movemask_epi8(found))
+						break;
+				}
+
+				for (; index + step <= count; index += step)
+				{
+					uint32_t matches = static_cast<uint32_t>(
+						_mm256_movemask_epi8(equal256<char_t>(load256(str + index), needle))
+					);
+
+					if (0 != matches)
+						return index + std::countr_zero(matches) / sizeof(char_t);
+				}
+			}
+		#endif
+
+		#if defined(STD_EXT_SSE2)
+			{
+				constexpr size_t step = sizeof(__m128i) / sizeof(char_t);
+				const __m128i needle = splat128(value);
+
+				for (; index + 4 * step <= count; index += 4 * step)
+				{
+					const __m128i found = _mm_or_si128(
+						_mm_or_si128(
+							equal128<char_t>(load128(str + index), needle),
+							equal128<char_t>(load128(str + index + step), needle)
+						),
+						_mm_or_si128(
+							equal128<char_t>(load128(str + index + 2 * step), needle),
+							equal128<char_t>(load128(str + index + 3 * step), needle)
+						)
+					);
+
+					if (0 != _mm_movemask_epi8(found))
+						break;
+				}
+
+				for (; index + step <= count; index += step)
+				{
+					uint32_t matches = static_cast<uint32_t>(
+						_mm_movemask_epi8(equal128<char_t>(load128(str + index), needle))
+					);
+
+					if (0 != matches)
+						return index + std::countr_zero(matches) / sizeof(char_t);
+				}
+			}
+		#endif
+
+			for (; index < count; ++index)
+			{
+				if (str[index] == value)
+					return index;
+			}
+
+			return npos;
+		}
+
+		template<typename char_t>
+		size_t findAnyUnit(
+			const char_t* str, size_t count,
+			const char_t* set, size_t set_count,
+			size_t pos
+		) noexcept
+		{
+			if (0 == set_count)
+				return npos;
+
+			if (1 == set_count)
+				return findUnit(str, count, set[0], pos);
+
+			size_t index = pos;
+
+		#if defined(STD_EXT_SSE4_2)
+			if constexpr (sizeof(char_t) <= 2)
+			{
+				constexpr size_t step = sizeof(__m128i) / sizeof(char_t);
+
+				constexpr int mode = _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT |
+					((sizeof(char_t) == 1) ? _SIDD_UBYTE_OPS : _SIDD_UWORD_OPS);
+
+				if (set_count <= step)
+				{
+					char_t set_units[step] = {};
+					memcpy(set_units, set, set_count * sizeof(char_t));
+
+					const __m128i set_block = load128(set_units);
+
+					for (; index + step <= count; index += step)
+					{
+						int match = _mm_cmpestri(
+							set_block, static_cast<int>(set_count),
+							load128(str + index), static_cast<int>(step),
+							mode
+						);
+
+						if (match < static_cast<int>(step))
+							return index + match;
+					}
+				}
+			}
+		#endif
+
+		#if defined(STD_EXT_SSE2)
+			if (set_count <= MaxVectorSet)
+			{
+				constexpr size_t step = sizeof(__m128i) / sizeof(char_t);
+
+				__m128i set_blocks[MaxVectorSet];
+
+				for (size_t i = 0; i < set_count; ++i)
+					set_blocks[i] = splat128(set[i]);
+
+				for (; index + step <= count; index += step)
+				{
+					const __m128i block = load128(str + index);
+					__m128i found = equal128<char_t>(block, set_blocks[0]);
+
+					for (size_t i = 1; i < set_count; ++i)
+						found = _mm_or_si128(found, equal128<char_t>(block, set_blocks[i]));
+
+					uint32_t matches = static_cast<uint32_t>(_mm_movemask_epi8(found));
+
+					if (0 != matches)
+						return index + std::countr_zero(matches) / sizeof(char_t);
+				}
+			}
+		#endif
+
+			if constexpr (sizeof(char_t) == 1)
+			{
+				if (set_count > MaxVectorSet && count > index)
+				{
+					bool in_set[256] = {};
+
+					for (size_t i = 0; i < set_count; ++i)
+						in_set[set[i]] = true;
+
+					for (; index < count; ++index)
+					{
+						if (in_set[str[index]])
+							return index;
+					}
+
+					return npos;
+				}
+			}
+
+			for (; index < count; ++index)
+			{
+				for (size_t i = 0; i < set_count; ++i)
+				{
+					if (str[index] == set[i])
+						return index;
+				}
+			}
+
+			return npos;
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Finds a sequence of two or more code units by comparing blocks of the string
+		 *  against the first and last units of the needle, only comparing the rest of the
+		 *  needle at positions where both match.
+		 */
+		template<typename char_t>
+		size_t findSequence(
+			const char_t* str, size_t count,
+			const char_t* needle, size_t needle_count,
+			size_t pos
+		) noexcept
+		{
+			if (pos > count || needle_count > count - pos)
+				return npos;
+
+			if (0 == needle_count)
+				return pos;
+
+			if (1 == needle_count)
+				return findUnit(str, count, needle[0], pos);
+
+			const size_t last_start = count - needle_count;
+			const size_t last_offset = needle_count - 1;
+			const size_t middle_bytes = (needle_count - 2) * sizeof(char_t);
+
+			auto middleMatches = [&](size_t candidate)
+			{
+				return 0 == memcmp(str + candidate + 1, needle + 1, middle_bytes);
+			};
+
+			size_t index = pos;
+
+		#if defined(STD_EXT_AVX2)
+			{
+				constexpr size_t step = sizeof(__m256i) / sizeof(char_t);
+				const __m256i first = splat256(needle[0]);
+				const __m256i last = splat256(needle[last_offset]);
+
+				for (; index + step - 1 <= last_start; index += step)
+				{
+					uint32_t candidates = static_cast<uint32_t>(
+						_mm256_movemask_epi8(
+							_mm256_and_si256(
+								equal256<char_t>(load256(str + index), first),
+								equal256<char_t>(load256(str + index + last_offset), last)
+							)
+						)
+					);
+
+					while (0 != candidates)
+					{
+						uint32_t bit = std::countr_zero(candidates);
+						size_t candidate = index + bit / sizeof(char_t);
+
+						if (middleMatches(candidate))
+							return candidate;
+
+						candidates &= ~(UnitBits<char_t> << bit);
+					}
+				}
+			}
+		#endif
+
+		#if defined(STD_EXT_SSE2)
+			{
+				constexpr size_t step = sizeof(__m128i) / sizeof(char_t);
+				const __m128i first = splat128(needle[0]);
+				const __m128i last = splat128(needle[last_offset]);
+
+				for (; index + step - 1 <= last_start; index += step)
+				{
+					uint32_t candidates = static_cast<uint32_t>(
+						_mm_movemask_epi8(
+							_mm_and_si128(
+								equal128<char_t>(load128(str + index), first),
+								equal128<char_t>(load128(str + index + last_offset), last)
+							)
+						)
+					);
+
+					while (0 != candidates)
+					{
+						uint32_t bit = std::countr_zero(candidates);
+						size_t candidate = index + bit / sizeof(char_t);
+
+						if (middleMatches(candidate))
+							return candidate;
+
+						candidates &= ~(UnitBits<char_t> << bit);
+					}
+				}
+			}
+		#endif
+
+			for (; index <= last_start; ++index)
+			{
+				if ( str[index] == needle[0] &&
+				     str[index + last_offset] == needle[last_offset] &&
+				     middleMatches(index) )
+				{
+					return index;
+				}
+			}
+
+			return npos;
+		}
+
+		template<Character char_t>
+		const unit_t<char_t>* units(std::basic_string_view<char_t> str) noexcept
+		{
+			return reinterpret_cast<const unit_t<char_t>*>(str.data());
+		}
+	}
+
+	template<Character char_t>
+	size_t find(std::basic_string_view<char_t> str, char_t ch, size_t pos) noexcept
+	{
+		return findUnit(
+			units(str), str.size(),
+			static_cast<unit_t<char_t>>(ch), pos
+		);
+	}
+
+	template<Character char_t>
+	size_t find(
+		std::basic_string_view<char_t> str,
+		std::basic_string_view<char_t> substr,
+		size_t pos
+	) noexcept
+	{
+		return findSequence(
+			units(str), str.size(),
+			units(substr), substr.size(), pos
+		);
+	}
+
+	template<Character char_t>
+	size_t findFirstOf(
+		std::basic_string_view<char_t> str,
+		std::basic_string_view<char_t> set,
+		size_t pos
+	) noexcept
+	{
+		return findAnyUnit(
+			units(str), str.size(),
+			units(set), set.size(), pos
+		);
+	}
+
+	template size_t find<char>(std::string_view, char, size_t) noexcept;
+	template size_t find<char8_t>(std::u8string_view, char8_t, size_t) noexcept;
+	template size_t find<char16_t>(std::u16string_view, char16_t, size_t) noexcept;
+	template size_t find<char32_t>(std::u32string_view, char32_t, size_t) noexcept;
+	template size_t find<wchar_t>(std::wstring_view, wchar_t, size_t) noexcept;
+
+	template size_t find<char>(std::string_view, std::string_view, size_t) noexcept;
+	template size_t find<char8_t>(std::u8string_view, std::u8string_view, size_t) noexcept;
+	template size_t find<char16_t>(std::u16string_view, std::u16string_view, size_t) noexcept;
+	template size_t find<char32_t>(std::u32string_view, std::u32string_view, size_t) noexcept;
+	template size_t find<wchar_t>(std::wstring_view, std::wstring_view, size_t) noexcept;
+
+	template size_t findFirstOf<char>(std::string_view, std::string_view, size_t) noexcept;
+	template size_t findFirstOf<char8_t>(std::u8string_view, std::u8string_view, size_t) noexcept;
+	template size_t findFirstOf<char16_t>(std::u16string_view, std::u16string_view, size_t) noexcept;
+	template size_t findFirstOf<char32_t>(std::u32string_view, std::u32string_view, size_t) noexcept;
+	template size_t findFirstOf<wchar_t>(std::wstring_view, std::wstring_view, size_t) noexcept;
+}
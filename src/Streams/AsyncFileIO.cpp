@@ -0,0 +1,920 @@
+#include <StdExt/Streams/AsyncFileIO.h>
+
+#include <StdExt/Exceptions.h>
+#include <StdExt/Memory/ObjectPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+#if defined(STD_EXT_LINUX)
+#	include <cerrno>
+#	include <cstring>
+#	include <linux/io_uring.h>
+#	include <sys/mman.h>
+#	include <sys/syscall.h>
+#	include <sys/uio.h>
+#	include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace StdExt::Streams::Detail
+{
+	enum class AsyncOp
+	{
+		Read,
+		Write
+	};
+
+	struct AsyncRequest
+	{
+		AsyncOp op;
+		FdFileStream* file;
+		uint64_t offset;
+		std::byte* data;
+		size_t length;
+		size_t transferred = 0;
+
+		SharedDataView<> keepAlive;
+
+		std::optional<std::promise<size_t>> promise;
+		AsyncFileIO::Completion callback;
+
+	#if defined(STD_EXT_LINUX)
+		iovec vec{};
+	#endif
+	};
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Request bookkeeping shared by the backends.  Backends implement enqueue() to
+	 *  start requests, and call complete() when each one finishes.
+	 */
+	class AsyncEngine
+	{
+	public:
+		AsyncEngine(size_t queueDepth)
+			: mInFlight(0), mQueueDepth(std::max<size_t>(queueDepth, 1))
+		{
+		}
+
+		virtual ~AsyncEngine() = default;
+
+		virtual AsyncFileIO::Backend backend() const = 0;
+
+		size_t queueDepth() const
+		{
+			return mQueueDepth;
+		}
+
+		/**
+		 * @brief
+		 *  Checks that the request is valid for the file and creates its record.
+		 */
+		AsyncRequest* makeRequest(
+			AsyncOp op, FdFileStream& file, uint64_t offset, const void* data, size_t length,
+			SharedDataView<> keepAlive
+		)
+		{
+			if ( !file.isOpen() )
+			{
+				throw invalid_operation( (AsyncOp::Read == op) ?
+					"Attempting to read on an unopened file." :
+					"Attempting to write on an unopened file."
+				);
+			}
+
+			if ( AsyncOp::Write == op && (file.getFlags() & ByteStream::READ_ONLY) != 0 )
+				throw invalid_operation("Attempting to write on a read only stream.");
+
+			file.checkDirectIO(offset, data, length);
+
+			AsyncRequest* request = mRequests.create();
+
+			request->op = op;
+			request->file = &file;
+			request->offset = offset;
+			request->data = static_cast<std::byte*>(const_cast<void*>(data));
+			request->length = length;
+			request->keepAlive = std::move(keepAlive);
+
+			return request;
+		}
+
+		/**
+		 * @brief
+		 *  Destroys a request that was never submitted.
+		 */
+		void discard(AsyncRequest* request) noexcept
+		{
+			mRequests.destroy(request);
+		}
+
+		/**
+		 * @brief
+		 *  Hands requests to the backend, as many at a time as there are free slots in
+		 *  the queue, blocking until slots free up.
+		 *
+		 * @details
+		 *  If the backend fails to start a request, it and all the requests after it are
+		 *  completed with the exception, which is then rethrown.
+		 */
+		void submit(std::span<AsyncRequest* const> requests)
+		{
+			size_t index = 0;
+
+			try
+			{
+				while (index < requests.size())
+				{
+					size_t count = reserve(requests.size() - index);
+					index += count;
+
+					enqueue( requests.subspan(index - count, count) );
+				}
+			}
+			catch (...)
+			{
+				// enqueue() has failed the requests it was given but did not start, so only
+				// those that never got a slot are left.
+				std::exception_ptr error = std::current_exception();
+
+				for (AsyncRequest* request : requests.subspan(index))
+					report(request, error);
+
+				throw;
+			}
+		}
+
+		void drain()
+		{
+			std::unique_lock lock(mSlotLock);
+			mSlotFreed.wait(lock, [this]() { return 0 == mInFlight; });
+		}
+
+	protected:
+		/**
+		 * @brief
+		 *  Starts requests, each of which has a slot in the queue.  If it throws, the
+		 *  requests it did not start must first be passed to fail().
+		 */
+		virtual void enqueue(std::span<AsyncRequest* const> requests) = 0;
+
+		/**
+		 * @brief
+		 *  Reports the result of a request to its future or callback, and frees its slot
+		 *  in the queue.
+		 */
+		void complete(AsyncRequest* request, std::exception_ptr error) noexcept
+		{
+			report(request, error);
+
+			{
+				std::lock_guard lock(mSlotLock);
+				--mInFlight;
+			}
+
+			mSlotFreed.notify_all();
+		}
+
+		/**
+		 * @brief
+		 *  Completes requests that could not be started with error.
+		 */
+		void fail(std::span<AsyncRequest* const> requests, std::exception_ptr error) noexcept
+		{
+			for (AsyncRequest* request : requests)
+				complete(request, error);
+		}
+
+	private:
+		/**
+		 * @brief
+		 *  Reports the result of a request to its future or callback, and destroys it.
+		 */
+		void report(AsyncRequest* request, std::exception_ptr error) noexcept
+		{
+			if ( !error && AsyncOp::Write == request->op )
+				request->file->extendSize(request->offset + request->transferred);
+
+			if (request->callback)
+			{
+				try
+				{
+					request->callback(request->transferred, error);
+				}
+				catch (...)
+				{
+					// The callback runs on a backend thread, and there is no one to report
+					// the exception to.
+				}
+			}
+			else if (error)
+			{
+				request->promise->set_exception(error);
+			}
+			else
+			{
+				request->promise->set_value(request->transferred);
+			}
+
+			mRequests.destroy(request);
+		}
+
+		size_t reserve(size_t count)
+		{
+			std::unique_lock lock(mSlotLock);
+			mSlotFreed.wait(lock, [this]() { return mInFlight < mQueueDepth; });
+
+			size_t reserved = std::min(count, mQueueDepth - mInFlight);
+			mInFlight += reserved;
+
+			return reserved;
+		}
+
+		ObjectPool<AsyncRequest> mRequests;
+
+		std::mutex mSlotLock;
+		std::condition_variable mSlotFreed;
+		size_t mInFlight;
+		size_t mQueueDepth;
+	};
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Backend with worker threads performing blocking positional reads and writes.
+	 */
+	class ThreadPoolEngine : public AsyncEngine
+	{
+	public:
+		ThreadPoolEngine(size_t queueDepth)
+			: AsyncEngine(queueDepth), mStopping(false)
+		{
+			size_t thread_count = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 4);
+			thread_count = std::min(thread_count, this->queueDepth());
+
+			for (size_t i = 0; i < thread_count; ++i)
+				mWorkers.emplace_back([this]() { work(); });
+		}
+
+		virtual ~ThreadPoolEngine()
+		{
+			drain();
+
+			{
+				std::lock_guard lock(mQueueLock);
+				mStopping = true;
+			}
+
+			mQueued.notify_all();
+
+			for (auto& worker : mWorkers)
+				worker.join();
+		}
+
+		virtual AsyncFileIO::Backend backend() const override
+		{
+			return AsyncFileIO::Backend::ThreadPool;
+		}
+
+	protected:
+		virtual void enqueue(std::span<AsyncRequest* const> requests) override
+		{
+			try
+			{
+				std::lock_guard lock(mQueueLock);
+				size_t queued = mQueue.size();
+
+				try
+				{
+					mQueue.insert(mQueue.end(), requests.begin(), requests.end());
+				}
+				catch (...)
+				{
+					mQueue.resize(queued);
+					throw;
+				}
+			}
+			catch (...)
+			{
+				fail(requests, std::current_exception());
+				throw;
+			}
+
+			if (1 == requests.size())
+				mQueued.notify_one();
+			else
+				mQueued.notify_all();
+		}
+
+	private:
+		void work()
+		{
+			while (true)
+			{
+				AsyncRequest* request = nullptr;
+
+				{
+					std::unique_lock lock(mQueueLock);
+					mQueued.wait(lock, [this]() { return mStopping || !mQueue.empty(); });
+
+					if (mQueue.empty())
+						return;
+
+					request = mQueue.front();
+					mQueue.pop_front();
+				}
+
+				std::exception_ptr error;
+
+				try
+				{
+					if (AsyncOp::Read == request->op)
+					{
+						request->transferred = request->file->readAt(request->offset, request->data, request->length);
+					}
+					else
+					{
+						request->file->writeAt(request->offset, request->data, request->length);
+						request->transferred = request->length;
+					}
+				}
+				catch (...)
+				{
+					error = std::current_exception();
+				}
+
+				complete(request, error);
+			}
+		}
+
+		std::mutex mQueueLock;
+		std::condition_variable mQueued;
+		std::deque<AsyncRequest*> mQueue;
+		std::vector<std::thread> mWorkers;
+		bool mStopping;
+	};
+
+#if defined(STD_EXT_LINUX)
+
+	static int io_uring_setup(unsigned entries, io_uring_params* params)
+	{
+		return static_cast<int>( syscall(__NR_io_uring_setup, entries, params) );
+	}
+
+	static int io_uring_enter(int ring, unsigned to_submit, unsigned min_complete, unsigned flags)
+	{
+		return static_cast<int>( syscall(__NR_io_uring_enter, ring, to_submit, min_complete, flags, nullptr, 0) );
+	}
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Backend submitting vectored reads and writes to an io_uring, with a thread that
+	 *  waits for and dispatches completions.
+	 *
+	 * @details
+	 *  Uses the system calls directly, so there is no dependency on liburing.  The
+	 *  completion queue is twice the size of the submission queue, and the number of
+	 *  requests in flight never exceeds the submission queue, so completions cannot
+	 *  overflow.
+	 */
+	class IoUringEngine : public AsyncEngine
+	{
+	public:
+		/**
+		 * @brief
+		 *  The largest submission queue requested.  The queue depth of the engine is
+		 *  limited to it, since a submission larger than the ring would overwrite its
+		 *  own entries before they reach the kernel.
+		 */
+		static constexpr size_t MaxRingEntries = 4096;
+
+		IoUringEngine(size_t queueDepth)
+			: AsyncEngine( std::min(queueDepth, MaxRingEntries) )
+		{
+			io_uring_params params{};
+			mRing = io_uring_setup(static_cast<unsigned>(this->queueDepth()), &params);
+
+			if (mRing < 0)
+				throw not_supported("io_uring is not available.");
+
+			mSqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+			mCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+			mSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+			bool single_map = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+
+			if (single_map)
+				mSqRingSize = mCqRingSize = std::max(mSqRingSize, mCqRingSize);
+
+			mSqRing = mmap(nullptr, mSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRing, IORING_OFF_SQ_RING);
+			mCqRing = single_map ? mSqRing :
+				mmap(nullptr, mCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRing, IORING_OFF_CQ_RING);
+			void* sqes = mmap(nullptr, mSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRing, IORING_OFF_SQES);
+
+			if (MAP_FAILED == mSqRing || MAP_FAILED == mCqRing || MAP_FAILED == sqes)
+			{
+				if (MAP_FAILED != sqes)
+					munmap(sqes, mSqesSize);
+
+				if (MAP_FAILED != mCqRing && !single_map)
+					munmap(mCqRing, mCqRingSize);
+
+				if (MAP_FAILED != mSqRing)
+					munmap(mSqRing, mSqRingSize);
+
+				::close(mRing);
+				throw not_supported("Failed to map io_uring queues.");
+			}
+
+			std::byte* sq = static_cast<std::byte*>(mSqRing);
+			std::byte* cq = static_cast<std::byte*>(mCqRing);
+
+			mSqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+			mSqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+			mSqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+			mSqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+			mSqes = static_cast<io_uring_sqe*>(sqes);
+
+			mCqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+			mCqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+			mCqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+			mCqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+			mReaper = std::thread([this]() { reap(); });
+		}
+
+		virtual ~IoUringEngine()
+		{
+			drain();
+
+			{
+				// A no-op without a request tells the reaper to stop.
+				std::lock_guard lock(mSubmitLock);
+
+				io_uring_sqe* sqe = nextSqe();
+				sqe->opcode = IORING_OP_NOP;
+				sqe->user_data = 0;
+
+				unsigned count = 1;
+				enter(count);
+			}
+
+			mReaper.join();
+
+			munmap(mSqes, mSqesSize);
+
+			if (mCqRing != mSqRing)
+				munmap(mCqRing, mCqRingSize);
+
+			munmap(mSqRing, mSqRingSize);
+			::close(mRing);
+		}
+
+		virtual AsyncFileIO::Backend backend() const override
+		{
+			return AsyncFileIO::Backend::IoUring;
+		}
+
+	protected:
+		virtual void enqueue(std::span<AsyncRequest* const> requests) override
+		{
+			unsigned count = static_cast<unsigned>(requests.size());
+			std::exception_ptr error;
+
+			{
+				std::lock_guard lock(mSubmitLock);
+
+				for (AsyncRequest* request : requests)
+					prepare(request);
+
+				try
+				{
+					enter(count);
+				}
+				catch (...)
+				{
+					error = std::current_exception();
+				}
+			}
+
+			if (error)
+			{
+				// The kernel takes entries in order, so the requests it did not take are
+				// the last ones.  They are failed without the lock, since their callbacks
+				// may submit more requests.
+				fail(requests.last(count), error);
+				std::rethrow_exception(error);
+			}
+		}
+
+	private:
+
+		/**
+		 * @brief
+		 *  Claims the next submission queue entry.  The caller must hold mSubmitLock.
+		 */
+		io_uring_sqe* nextSqe()
+		{
+			unsigned tail = *mSqTail;
+			unsigned index = tail & mSqMask;
+
+			io_uring_sqe* sqe = &mSqes[index];
+			memset(sqe, 0, sizeof(io_uring_sqe));
+
+			mSqArray[index] = index;
+			std::atomic_ref<unsigned>(*mSqTail).store(tail + 1, std::memory_order_release);
+
+			return sqe;
+		}
+
+		/**
+		 * @brief
+		 *  Queues the untransferred part of a request.  The caller must hold mSubmitLock.
+		 */
+		void prepare(AsyncRequest* request)
+		{
+			request->vec.iov_base = request->data + request->transferred;
+			request->vec.iov_len = request->length - request->transferred;
+
+			io_uring_sqe* sqe = nextSqe();
+			sqe->opcode = (AsyncOp::Read == request->op) ? IORING_OP_READV : IORING_OP_WRITEV;
+			sqe->fd = static_cast<int>(request->file->nativeHandle());
+			sqe->off = request->offset + request->transferred;
+			sqe->addr = reinterpret_cast<uint64_t>(&request->vec);
+			sqe->len = 1;
+			sqe->user_data = reinterpret_cast<uint64_t>(request);
+		}
+
+		/**
+		 * @brief
+		 *  Submits the last count queued entries to the kernel.  The caller must hold
+		 *  mSubmitLock.
+		 *
+		 * @details
+		 *  On failure, the entries the kernel did not take are withdrawn from the queue,
+		 *  so they are not submitted by a later call, and count is left as their number.
+		 */
+		void enter(unsigned& count)
+		{
+			while (count > 0)
+			{
+				int result = io_uring_enter(mRing, count, 0, 0);
+
+				if (result < 0)
+				{
+					if (EINTR == errno || EAGAIN == errno || EBUSY == errno)
+						continue;
+
+					int error = errno;
+
+					std::atomic_ref<unsigned>(*mSqTail).store(*mSqTail - count, std::memory_order_release);
+					throw std::system_error(error, std::generic_category(), "Failed to submit to io_uring.");
+				}
+
+				count -= static_cast<unsigned>(result);
+			}
+		}
+
+		void reap()
+		{
+			while (true)
+			{
+				io_uring_enter(mRing, 0, 1, IORING_ENTER_GETEVENTS);
+
+				unsigned head = *mCqHead;
+				unsigned tail = std::atomic_ref<unsigned>(*mCqTail).load(std::memory_order_acquire);
+
+				bool stopping = false;
+
+				while (head != tail)
+				{
+					const io_uring_cqe& cqe = mCqes[head & mCqMask];
+					++head;
+
+					if (0 == cqe.user_data)
+						stopping = true;
+					else
+						finish(reinterpret_cast<AsyncRequest*>(cqe.user_data), cqe.res);
+				}
+
+				std::atomic_ref<unsigned>(*mCqHead).store(head, std::memory_order_release);
+
+				if (stopping)
+					return;
+			}
+		}
+
+		void finish(AsyncRequest* request, int result)
+		{
+			if (result < 0 && -EINTR != result && -EAGAIN != result)
+			{
+				complete(
+					request,
+					std::make_exception_ptr(
+						std::system_error(-result, std::generic_category(), "Asynchronous file I/O failed.")
+					)
+				);
+
+				return;
+			}
+
+			if (result > 0)
+				request->transferred += static_cast<size_t>(result);
+
+			// Transfers can be cut short, by signals or by the kernel's limit on the size
+			// of a single transfer, so the remainder is queued again.  A read that returns
+			// nothing has reached the end of the file.
+			if ( result != 0 && request->transferred < request->length )
+			{
+				try
+				{
+					std::lock_guard lock(mSubmitLock);
+					unsigned count = 1;
+
+					prepare(request);
+					enter(count);
+				}
+				catch (...)
+				{
+					complete(request, std::current_exception());
+				}
+
+				return;
+			}
+
+			complete(request, nullptr);
+		}
+
+		int mRing;
+
+		void* mSqRing;
+		size_t mSqRingSize;
+		void* mCqRing;
+		size_t mCqRingSize;
+		size_t mSqesSize;
+
+		unsigned* mSqHead;
+		unsigned* mSqTail;
+		unsigned mSqMask;
+		unsigned* mSqArray;
+		io_uring_sqe* mSqes;
+
+		unsigned* mCqHead;
+		unsigned* mCqTail;
+		unsigned mCqMask;
+		io_uring_cqe* mCqes;
+
+		std::mutex mSubmitLock;
+		std::thread mReaper;
+	};
+
+#endif
+}
+
+namespace StdExt::Streams
+{
+	using Detail::AsyncOp;
+	using Detail::AsyncRequest;
+
+	static std::future<size_t> stageFuture(
+		Detail::AsyncEngine* engine, std::vector<AsyncRequest*>& requests,
+		AsyncOp op, FdFileStream& file, uint64_t offset, const void* data, size_t length,
+		SharedDataView<> keepAlive = {}
+	)
+	{
+		requests.reserve(requests.size() + 1);
+
+		AsyncRequest* request = engine->makeRequest(op, file, offset, data, length, std::move(keepAlive));
+		std::future<size_t> result;
+
+		try
+		{
+			request->promise.emplace();
+			result = request->promise->get_future();
+		}
+		catch (...)
+		{
+			engine->discard(request);
+			throw;
+		}
+
+		requests.push_back(request);
+		return result;
+	}
+
+	static void stageCallback(
+		Detail::AsyncEngine* engine, std::vector<AsyncRequest*>& requests,
+		AsyncOp op, FdFileStream& file, uint64_t offset, SharedDataView<> keepAlive,
+		AsyncFileIO::Completion&& callback
+	)
+	{
+		if (!callback)
+			throw std::invalid_argument("A completion callback is required.");
+
+		requests.reserve(requests.size() + 1);
+
+		void* data = keepAlive.data();
+		size_t length = keepAlive.size();
+
+		AsyncRequest* request = engine->makeRequest(op, file, offset, data, length, std::move(keepAlive));
+		request->callback = std::move(callback);
+
+		requests.push_back(request);
+	}
+
+	AsyncFileIO::Batch::Batch(AsyncFileIO& engine)
+		: mEngine(engine.mEngine.get())
+	{
+	}
+
+	AsyncFileIO::Batch::~Batch()
+	{
+		try
+		{
+			submit();
+		}
+		catch (...)
+		{
+		}
+	}
+
+	std::future<size_t> AsyncFileIO::Batch::read(FdFileStream& file, uint64_t offset, Buffer& destination)
+	{
+		return stageFuture(mEngine, mRequests, AsyncOp::Read, file, offset, destination.data(), destination.size());
+	}
+
+	std::future<size_t> AsyncFileIO::Batch::read(FdFileStream& file, uint64_t offset, SharedDataView<> destination)
+	{
+		void* data = destination.data();
+		size_t length = destination.size();
+
+		return stageFuture(mEngine, mRequests, AsyncOp::Read, file, offset, data, length, std::move(destination));
+	}
+
+	std::future<size_t> AsyncFileIO::Batch::write(FdFileStream& file, uint64_t offset, const Buffer& data)
+	{
+		return stageFuture(mEngine, mRequests, AsyncOp::Write, file, offset, data.data(), data.size());
+	}
+
+	std::future<size_t> AsyncFileIO::Batch::write(FdFileStream& file, uint64_t offset, SharedDataView<> data)
+	{
+		void* bytes = data.data();
+		size_t length = data.size();
+
+		return stageFuture(mEngine, mRequests, AsyncOp::Write, file, offset, bytes, length, std::move(data));
+	}
+
+	void AsyncFileIO::Batch::read(FdFileStream& file, uint64_t offset, SharedDataView<> destination, Completion callback)
+	{
+		stageCallback(mEngine, mRequests, AsyncOp::Read, file, offset, std::move(destination), std::move(callback));
+	}
+
+	void AsyncFileIO::Batch::write(FdFileStream& file, uint64_t offset, SharedDataView<> data, Completion callback)
+	{
+		stageCallback(mEngine, mRequests, AsyncOp::Write, file, offset, std::move(data), std::move(callback));
+	}
+
+	size_t AsyncFileIO::Batch::size() const
+	{
+		return mRequests.size();
+	}
+
+	void AsyncFileIO::Batch::submit()
+	{
+		if (mRequests.empty())
+			return;
+
+		std::vector<AsyncRequest*> requests = std::move(mRequests);
+		mRequests.clear();
+
+		mEngine->submit(requests);
+	}
+
+	AsyncFileIO::AsyncFileIO(size_t queueDepth, Backend backend)
+	{
+	#if defined(STD_EXT_LINUX)
+		if (Backend::ThreadPool != backend)
+		{
+			try
+			{
+				mEngine = std::make_unique<Detail::IoUringEngine>(queueDepth);
+			}
+			catch (const not_supported&)
+			{
+				if (Backend::IoUring == backend)
+					throw;
+			}
+		}
+	#else
+		if (Backend::IoUring == backend)
+			throw not_supported("io_uring is only available on Linux.");
+	#endif
+
+		if (!mEngine)
+			mEngine = std::make_unique<Detail::ThreadPoolEngine>(queueDepth);
+	}
+
+	AsyncFileIO::~AsyncFileIO()
+	{
+	}
+
+	AsyncFileIO::Backend AsyncFileIO::backend() const
+	{
+		return mEngine->backend();
+	}
+
+	size_t AsyncFileIO::queueDepth() const
+	{
+		return mEngine->queueDepth();
+	}
+
+	bool AsyncFileIO::ioUringAvailable()
+	{
+	#if defined(STD_EXT_LINUX)
+		static const bool available = []()
+		{
+			io_uring_params params{};
+			int ring = Detail::io_uring_setup(1, &params);
+
+			if (ring < 0)
+				return false;
+
+			::close(ring);
+			return true;
+		}();
+
+		return available;
+	#else
+		return false;
+	#endif
+	}
+
+	std::future<size_t> AsyncFileIO::read(FdFileStream& file, uint64_t offset, Buffer& destination)
+	{
+		Batch batch(*this);
+		std::future<size_t> result = batch.read(file, offset, destination);
+
+		batch.submit();
+		return result;
+	}
+
+	std::future<size_t> AsyncFileIO::read(FdFileStream& file, uint64_t offset, SharedDataView<> destination)
+	{
+		Batch batch(*this);
+		std::future<size_t> result = batch.read(file, offset, std::move(destination));
+
+		batch.submit();
+		return result;
+	}
+
+	std::future<size_t> AsyncFileIO::write(FdFileStream& file, uint64_t offset, const Buffer& data)
+	{
+		Batch batch(*this);
+		std::future<size_t> result = batch.write(file, offset, data);
+
+		batch.submit();
+		return result;
+	}
+
+	std::future<size_t> AsyncFileIO::write(FdFileStream& file, uint64_t offset, SharedDataView<> data)
+	{
+		Batch batch(*this);
+		std::future<size_t> result = batch.write(file, offset, std::move(data));
+
+		batch.submit();
+		return result;
+	}
+
+	void AsyncFileIO::read(FdFileStream& file, uint64_t offset, SharedDataView<> destination, Completion callback)
+	{
+		Batch batch(*this);
+		batch.read(file, offset, std::move(destination), std::move(callback));
+
+		batch.submit();
+	}
+
+	void AsyncFileIO::write(FdFileStream& file, uint64_t offset, SharedDataView<> data, Completion callback)
+	{
+		Batch batch(*this);
+		batch.write(file, offset, std::move(data), std::move(callback));
+
+		batch.submit();
+	}
+
+	void AsyncFileIO::drain()
+	{
+		mEngine->drain();
+	}
+}
@@ -1,7 +1,11 @@
 #include <StdExt/Streams/BufferedStream.h>
 
+#include <StdExt/Utility.h>
+
+#include <algorithm>
 #include <stdexcept>
 #include <cstring>
+#include <utility>
 
 using namespace std;
 
@@ -43,14 +47,39 @@ namespace StdExt::Streams
 
 	void BufferedStream::writeRaw(const void* data, size_t byteLength)
 	{
-		if (mSeekPosition + byteLength >= mBuffer.size())
-			mBuffer.resize((mSeekPosition + byteLength) / BLOCK_SIZE + BLOCK_SIZE);
+		if (0 < byteLength)
+			memcpy(expandForWrite(byteLength), data, byteLength);
+	}
 
-		memcpy((char*)mBuffer.data() + mSeekPosition, data, byteLength);
-		mSeekPosition += byteLength;
+	void BufferedStream::readVec(std::span<const MutableBuffer> buffers)
+	{
+		size_t total = totalSize(buffers);
 
-		if (mBytesWritten <= mSeekPosition)
-			mBytesWritten = mSeekPosition;
+		if (mSeekPosition + total > mBytesWritten)
+			throw out_of_range("Attempted to read beyond the range of the stream.");
+
+		for (const MutableBuffer& buffer : buffers)
+		{
+			if (0 < buffer.size)
+			{
+				memcpy(buffer.data, (char*)mBuffer.data() + mSeekPosition, buffer.size);
+				mSeekPosition += buffer.size;
+			}
+		}
+	}
+
+	void BufferedStream::writeVec(std::span<const ConstBuffer> buffers)
+	{
+		char* out = (char*)expandForWrite(totalSize(buffers));
+
+		for (const ConstBuffer& buffer : buffers)
+		{
+			if (0 < buffer.size)
+			{
+				memcpy(out, buffer.data, buffer.size);
+				out += buffer.size;
+			}
+		}
 	}
 
 	void BufferedStream::seek(size_t position)
@@ -90,8 +119,7 @@ namespace StdExt::Streams
 
 	void* BufferedStream::expandForWrite(size_t byteLength)
 	{
-		if (mSeekPosition + byteLength >= mBuffer.size())
-			mBuffer.resize((mSeekPosition + byteLength) / BLOCK_SIZE + BLOCK_SIZE);
+		growFor(mSeekPosition + byteLength);
 		
 		void* ret = (char*)mBuffer.data() + mSeekPosition;
 		mSeekPosition += byteLength;
@@ -101,4 +129,42 @@ namespace StdExt::Streams
 
 		return ret;
 	}
+
+	std::span<std::byte> BufferedStream::writeSpan(size_t byteLength)
+	{
+		return std::span<std::byte>((std::byte*)expandForWrite(byteLength), byteLength);
+	}
+
+	void BufferedStream::reserve(size_t capacity)
+	{
+		if (capacity > mBuffer.size())
+			mBuffer.resize( nextMultipleOf(capacity, BLOCK_SIZE) );
+	}
+
+	size_t BufferedStream::capacity() const
+	{
+		return mBuffer.size();
+	}
+
+	StdExt::Buffer BufferedStream::release()
+	{
+		mBuffer.resize(mBytesWritten);
+
+		// A moved from Buffer has no valid alignment, so the stream gets a fresh one
+		// that later writes can grow.
+		StdExt::Buffer ret = std::exchange(mBuffer, StdExt::Buffer());
+
+		mBytesWritten = 0;
+		mSeekPosition = 0;
+
+		return ret;
+	}
+
+	void BufferedStream::growFor(size_t end)
+	{
+		// Growing geometrically keeps the cost of reallocation proportional to the data
+		// written, no matter how small each write is.
+		if (end > mBuffer.size())
+			mBuffer.resize( nextMultipleOf(std::max(end, 2 * mBuffer.size()), BLOCK_SIZE) );
+	}
 }
\ No newline at end of file
@@ -62,6 +62,18 @@ namespace StdExt::Streams
 		throw not_supported("Stream does not support writing.");
 	}
 
+	void ByteStream::readVec(std::span<const MutableBuffer> buffers)
+	{
+		for (const MutableBuffer& buffer : buffers)
+			readRaw(buffer.data, buffer.size);
+	}
+
+	void ByteStream::writeVec(std::span<const ConstBuffer> buffers)
+	{
+		for (const ConstBuffer& buffer : buffers)
+			writeRaw(buffer.data, buffer.size);
+	}
+
 	void ByteStream::seek(size_t position)
 	{
 		throw not_supported("Stream does not seeking.");
@@ -86,4 +98,24 @@ namespace StdExt::Streams
 	{
 		mFlags = mask;
 	}
+
+	size_t ByteStream::totalSize(std::span<const ConstBuffer> buffers)
+	{
+		size_t total = 0;
+
+		for (const ConstBuffer& buffer : buffers)
+			total += buffer.size;
+
+		return total;
+	}
+
+	size_t ByteStream::totalSize(std::span<const MutableBuffer> buffers)
+	{
+		size_t total = 0;
+
+		for (const MutableBuffer& buffer : buffers)
+			total += buffer.size;
+
+		return total;
+	}
 }
\ No newline at end of file
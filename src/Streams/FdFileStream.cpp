@@ -0,0 +1,485 @@
+#include <StdExt/Streams/FdFileStream.h>
+
+#include <StdExt/Exceptions.h>
+
+#include "VectoredIO.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#if defined(STD_EXT_WIN32)
+#	define WIN32_LEAN_AND_MEAN
+#	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace StdExt::Streams
+{
+#if defined(STD_EXT_WIN32)
+	static void* const NoFile = INVALID_HANDLE_VALUE;
+#else
+	static constexpr int NoFile = -1;
+
+	static_assert(sizeof(off_t) >= sizeof(uint64_t), "FdFileStream requires 64-bit file offsets.");
+#endif
+
+	FdFileStream::FdFileStream()
+		: mFile(NoFile), mOptions(NO_OPTIONS), mSeekPosition(0), mSize(0)
+	{
+	}
+
+	FdFileStream::FdFileStream(const String& path, bool readonly, uint32_t options)
+		: FdFileStream()
+	{
+		open(path, readonly, options);
+	}
+
+	FdFileStream::FdFileStream(FdFileStream&& other) noexcept
+		: mFile(std::exchange(other.mFile, NoFile)),
+		  mOptions(std::exchange(other.mOptions, NO_OPTIONS)),
+		  mSeekPosition(std::exchange(other.mSeekPosition, 0)),
+		  mSize(other.mSize.exchange(0, std::memory_order_relaxed))
+	{
+		setFlags(other.getFlags());
+	}
+
+	FdFileStream::~FdFileStream()
+	{
+		close();
+	}
+
+	FdFileStream& FdFileStream::operator=(FdFileStream&& other) noexcept
+	{
+		if (this != &other)
+		{
+			close();
+
+			mFile = std::exchange(other.mFile, NoFile);
+			mOptions = std::exchange(other.mOptions, NO_OPTIONS);
+			mSeekPosition = std::exchange(other.mSeekPosition, 0);
+			mSize.store(other.mSize.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+
+			setFlags(other.getFlags());
+		}
+
+		return *this;
+	}
+
+	void FdFileStream::readRaw(void* destination, size_t byteLength)
+	{
+		if (byteLength > bytesAvailable())
+			throw out_of_range("Attempted to read passed the end of the file.");
+
+		if (readAt(mSeekPosition, destination, byteLength) != byteLength)
+			throw out_of_range("Attempted to read passed the end of the file.");
+
+		mSeekPosition += byteLength;
+	}
+
+	void FdFileStream::writeRaw(const void* data, size_t byteLength)
+	{
+		writeAt(mSeekPosition, data, byteLength);
+		mSeekPosition += byteLength;
+	}
+
+	void FdFileStream::readVec(std::span<const MutableBuffer> buffers)
+	{
+		size_t total = totalSize(buffers);
+
+		if (total > bytesAvailable())
+			throw out_of_range("Attempted to read passed the end of the file.");
+
+	#if defined(STD_EXT_WIN32)
+		ByteStream::readVec(buffers);
+	#else
+		if ((getFlags() & WRITE_ONLY) != 0)
+			throw invalid_operation("Attempting to read a write-only stream.");
+
+		uint64_t offset = mSeekPosition;
+
+		for (const MutableBuffer& buffer : buffers)
+		{
+			checkDirectIO(offset, buffer.data, buffer.size);
+			offset += buffer.size;
+		}
+
+		if (Detail::preadv_all(mFile, buffers, mSeekPosition) != total)
+			throw out_of_range("Attempted to read passed the end of the file.");
+
+		mSeekPosition += total;
+	#endif
+	}
+
+	void FdFileStream::writeVec(std::span<const ConstBuffer> buffers)
+	{
+	#if defined(STD_EXT_WIN32)
+		ByteStream::writeVec(buffers);
+	#else
+		if (!isOpen())
+			throw invalid_operation("Attempting to write on an unopened file.");
+
+		if ((getFlags() & READ_ONLY) != 0)
+			throw invalid_operation("Attempting to write on a read only stream.");
+
+		uint64_t offset = mSeekPosition;
+
+		for (const ConstBuffer& buffer : buffers)
+		{
+			checkDirectIO(offset, buffer.data, buffer.size);
+			offset += buffer.size;
+		}
+
+		size_t written = Detail::pwritev_all(mFile, buffers, mSeekPosition);
+
+		extendSize(mSeekPosition + written);
+		mSeekPosition += written;
+
+		if (written < totalSize(buffers))
+			throw std::system_error(EIO, std::generic_category(), "File write made no progress.");
+	#endif
+	}
+
+	void FdFileStream::seek(size_t position)
+	{
+		if (!isOpen())
+			throw invalid_operation("Attempting to seek on an unopened file.");
+
+		if (position > size())
+			throw out_of_range("Attempted to seek outside the bounds of the file.");
+
+		mSeekPosition = position;
+	}
+
+	size_t FdFileStream::getSeekPosition() const
+	{
+		return static_cast<size_t>(mSeekPosition);
+	}
+
+	size_t FdFileStream::bytesAvailable() const
+	{
+		uint64_t file_size = size();
+
+		return (mSeekPosition < file_size) ? static_cast<size_t>(file_size - mSeekPosition) : 0;
+	}
+
+	bool FdFileStream::canRead(size_t numBytes)
+	{
+		return isOpen() && numBytes <= bytesAvailable();
+	}
+
+	bool FdFileStream::canWrite(size_t numBytes, bool autoExpand)
+	{
+		if (!isOpen() || (getFlags() & READ_ONLY) != 0)
+			return false;
+
+		uint64_t end = mSeekPosition + numBytes;
+
+		if (end <= size())
+			return true;
+
+		if (!autoExpand)
+			return false;
+
+		try
+		{
+			resize(end);
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	void FdFileStream::clear()
+	{
+		if ((getFlags() & READ_ONLY) != 0)
+			throw invalid_operation("Attempting to clear a read-only file stream.");
+
+		resize(0);
+		mSeekPosition = 0;
+	}
+
+	bool FdFileStream::open(const String& path, bool readonly, uint32_t options)
+	{
+		if (isOpen())
+			return false;
+
+		setFlags(readonly ? (READ_ONLY | CAN_SEEK) : CAN_SEEK);
+
+		bool direct = (options & DIRECT_IO) != 0;
+
+	#if defined(STD_EXT_WIN32)
+		std::wstring ntPath = convertString<wchar_t>(path).toStdString();
+
+		HANDLE file = CreateFileW(
+			ntPath.c_str(), readonly ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE),
+			FILE_SHARE_READ, nullptr, readonly ? OPEN_EXISTING : OPEN_ALWAYS,
+			FILE_ATTRIBUTE_NORMAL | (direct ? (FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH) : 0),
+			nullptr
+		);
+
+		if (INVALID_HANDLE_VALUE == file)
+			throw std::runtime_error("Failed to open file.");
+
+		LARGE_INTEGER file_size;
+
+		if ( !GetFileSizeEx(file, &file_size) )
+		{
+			CloseHandle(file);
+			throw std::runtime_error("Failed to get the size of the file.");
+		}
+
+		mSize.store(static_cast<uint64_t>(file_size.QuadPart), std::memory_order_relaxed);
+	#else
+		std::filesystem::path f_path(path.view());
+
+		int open_flags = readonly ? O_RDONLY : (O_RDWR | O_CREAT);
+
+		#if defined(O_CLOEXEC)
+			open_flags |= O_CLOEXEC;
+		#endif
+
+		#if defined(O_DIRECT)
+			if (direct)
+				open_flags |= O_DIRECT;
+		#endif
+
+		int file = ::open(f_path.c_str(), open_flags, 0666);
+
+		if (file < 0)
+			throw std::system_error(errno, std::generic_category(), "Failed to open file.");
+
+		#if !defined(O_DIRECT) && defined(F_NOCACHE)
+			if (direct && 0 != fcntl(file, F_NOCACHE, 1))
+			{
+				::close(file);
+				throw std::runtime_error("Failed to disable caching of the file.");
+			}
+		#endif
+
+		struct stat file_stat;
+
+		if (0 != fstat(file, &file_stat))
+		{
+			::close(file);
+			throw std::runtime_error("Failed to get the size of the file.");
+		}
+
+		mSize.store(static_cast<uint64_t>(file_stat.st_size), std::memory_order_relaxed);
+	#endif
+
+		mFile = file;
+		mOptions = options;
+		mSeekPosition = 0;
+
+		return true;
+	}
+
+	void FdFileStream::close()
+	{
+		if (!isOpen())
+			return;
+
+	#if defined(STD_EXT_WIN32)
+		CloseHandle(mFile);
+	#else
+		::close(mFile);
+	#endif
+
+		mFile = NoFile;
+		mOptions = NO_OPTIONS;
+		mSeekPosition = 0;
+		mSize.store(0, std::memory_order_relaxed);
+	}
+
+	bool FdFileStream::isOpen() const
+	{
+		return NoFile != mFile;
+	}
+
+	size_t FdFileStream::readAt(uint64_t offset, void* destination, size_t byteLength) const
+	{
+		if (!isOpen())
+			throw invalid_operation("Attempting to read on an unopened file.");
+
+		if ((getFlags() & WRITE_ONLY) != 0)
+			throw invalid_operation("Attempting to read a write-only stream.");
+
+		checkDirectIO(offset, destination, byteLength);
+
+		std::byte* out = static_cast<std::byte*>(destination);
+		size_t total = 0;
+
+		while (total < byteLength)
+		{
+		#if defined(STD_EXT_WIN32)
+			OVERLAPPED position{};
+			position.Offset = static_cast<DWORD>((offset + total) & 0xFFFFFFFF);
+			position.OffsetHigh = static_cast<DWORD>((offset + total) >> 32);
+
+			DWORD request = static_cast<DWORD>(std::min<size_t>(byteLength - total, 0x40000000));
+			DWORD result = 0;
+
+			if ( !ReadFile(mFile, out + total, request, &result, &position) )
+			{
+				if (ERROR_HANDLE_EOF == GetLastError())
+					break;
+
+				throw std::runtime_error("Unknown file error.");
+			}
+		#else
+			ssize_t result = pread(mFile, out + total, byteLength - total, static_cast<off_t>(offset + total));
+
+			if (result < 0)
+			{
+				if (EINTR == errno)
+					continue;
+
+				throw std::system_error(errno, std::generic_category(), "Unknown file error.");
+			}
+		#endif
+
+			if (0 == result)
+				break;
+
+			total += static_cast<size_t>(result);
+		}
+
+		return total;
+	}
+
+	void FdFileStream::writeAt(uint64_t offset, const void* data, size_t byteLength)
+	{
+		if (!isOpen())
+			throw invalid_operation("Attempting to write on an unopened file.");
+
+		if ((getFlags() & READ_ONLY) != 0)
+			throw invalid_operation("Attempting to write on a read only stream.");
+
+		if (0 == byteLength)
+			return;
+
+		checkDirectIO(offset, data, byteLength);
+
+		const std::byte* in = static_cast<const std::byte*>(data);
+		size_t total = 0;
+
+		while (total < byteLength)
+		{
+		#if defined(STD_EXT_WIN32)
+			OVERLAPPED position{};
+			position.Offset = static_cast<DWORD>((offset + total) & 0xFFFFFFFF);
+			position.OffsetHigh = static_cast<DWORD>((offset + total) >> 32);
+
+			DWORD request = static_cast<DWORD>(std::min<size_t>(byteLength - total, 0x40000000));
+			DWORD result = 0;
+
+			if ( !WriteFile(mFile, in + total, request, &result, &position) )
+				throw std::runtime_error("Unknown file error.");
+		#else
+			ssize_t result = pwrite(mFile, in + total, byteLength - total, static_cast<off_t>(offset + total));
+
+			if (result < 0)
+			{
+				if (EINTR == errno)
+					continue;
+
+				throw std::system_error(errno, std::generic_category(), "Unknown file error.");
+			}
+		#endif
+
+			// Writing nothing for a non-empty request would never make progress.
+			if (0 == result)
+				throw std::system_error(EIO, std::generic_category(), "File write made no progress.");
+
+			total += static_cast<size_t>(result);
+		}
+
+		extendSize(offset + byteLength);
+	}
+
+	uint64_t FdFileStream::size() const
+	{
+		return mSize.load(std::memory_order_relaxed);
+	}
+
+	void FdFileStream::resize(uint64_t newSize)
+	{
+		if (!isOpen())
+			throw invalid_operation("Attempting to resize an unopened file.");
+
+		if ((getFlags() & READ_ONLY) != 0)
+			throw invalid_operation("Attempting to resize a read-only file stream.");
+
+	#if defined(STD_EXT_WIN32)
+		FILE_END_OF_FILE_INFO end_of_file{};
+		end_of_file.EndOfFile.QuadPart = static_cast<LONGLONG>(newSize);
+
+		if ( !SetFileInformationByHandle(mFile, FileEndOfFileInfo, &end_of_file, sizeof(end_of_file)) )
+			throw std::runtime_error("Failed to resize the file.");
+	#else
+		if (0 != ftruncate(mFile, static_cast<off_t>(newSize)))
+			throw std::system_error(errno, std::generic_category(), "Failed to resize the file.");
+	#endif
+
+		mSize.store(newSize, std::memory_order_relaxed);
+	}
+
+	void FdFileStream::flush()
+	{
+		if (!isOpen() || (getFlags() & READ_ONLY) != 0)
+			return;
+
+	#if defined(STD_EXT_WIN32)
+		if ( !FlushFileBuffers(mFile) )
+			throw std::runtime_error("Failed to flush the file.");
+	#else
+		if (0 != fsync(mFile))
+			throw std::system_error(errno, std::generic_category(), "Failed to flush the file.");
+	#endif
+	}
+
+	intptr_t FdFileStream::nativeHandle() const
+	{
+	#if defined(STD_EXT_WIN32)
+		return reinterpret_cast<intptr_t>(mFile);
+	#else
+		return static_cast<intptr_t>(mFile);
+	#endif
+	}
+
+	void FdFileStream::extendSize(uint64_t end)
+	{
+		// Other threads may be extending the file at the same time, so only ever raise
+		// the cached size.
+		uint64_t current = mSize.load(std::memory_order_relaxed);
+
+		while ( current < end && !mSize.compare_exchange_weak(current, end, std::memory_order_relaxed) )
+			;
+	}
+
+	void FdFileStream::checkDirectIO(uint64_t offset, const void* buffer, size_t byteLength) const
+	{
+		if ((mOptions & DIRECT_IO) == 0)
+			return;
+
+		if ( 0 != offset % DirectAlignment || 0 != byteLength % DirectAlignment ||
+		     0 != reinterpret_cast<uintptr_t>(buffer) % DirectAlignment )
+		{
+			throw std::invalid_argument(
+				"Direct I/O requires buffers, offsets and lengths aligned to FdFileStream::DirectAlignment."
+			);
+		}
+	}
+}
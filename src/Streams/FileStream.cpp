@@ -1,6 +1,8 @@
 #include <StdExt/Streams/FileStream.h>
 #include <StdExt/Number.h>
 
+#include "VectoredIO.h"
+
 #include <stdexcept>
 #include <filesystem>
 
@@ -8,10 +10,16 @@
 #	define _CRT_SECURE_NO_WARNINGS
 #endif
 
+#include <cerrno>
 #include <climits>
 #include <cstdio>
 #include <cstring>
 #include <stdexcept>
+#include <system_error>
+
+#if !defined(STD_EXT_WIN32)
+#	include <fcntl.h>
+#endif
 
 using namespace std;
 
@@ -116,7 +124,7 @@ namespace StdExt::Streams
 		size_t byteCount = byteLength;
 		size_t elementsRead = fread(destination, byteCount, 1, mFile);
 
-		if (elementsRead != byteCount)
+		if (elementsRead != 1)
 		{
 			if (0 != feof(mFile))
 				throw out_of_range("Attempted to read passed the end of the file.");
@@ -145,6 +153,72 @@ namespace StdExt::Streams
 		}
 	}
 
+	void FileStream::readVec(std::span<const MutableBuffer> buffers)
+	{
+	#if defined(STD_EXT_WIN32)
+		ByteStream::readVec(buffers);
+	#else
+		if ((getFlags() & WRITE_ONLY) != 0)
+			throw invalid_operation("Attempting to read a write-only stream.");
+
+		if (nullptr == mFile)
+			throw invalid_operation("Attempting to read on an unopened file.");
+
+		// The descriptor is read directly, so pending writes are flushed first and the
+		// stdio position is set past the data afterward, which also discards anything
+		// stdio had read ahead.
+		off_t position = ftello(mFile);
+
+		if (position < 0 || 0 != fflush(mFile))
+			throw std::runtime_error("Unknown file error.");
+
+		size_t total = totalSize(buffers);
+		size_t bytes_read = Detail::preadv_all(fileno(mFile), buffers, static_cast<uint64_t>(position));
+
+		if (bytes_read < total)
+		{
+			fseeko(mFile, position, SEEK_SET);
+			throw out_of_range("Attempted to read passed the end of the file.");
+		}
+
+		fseeko(mFile, position + static_cast<off_t>(total), SEEK_SET);
+	#endif
+	}
+
+	void FileStream::writeVec(std::span<const ConstBuffer> buffers)
+	{
+	#if defined(STD_EXT_WIN32)
+		ByteStream::writeVec(buffers);
+	#else
+		if (nullptr == mFile)
+			throw invalid_operation("Attempting to write on an unopened file.");
+
+		if ((getFlags() & READ_ONLY) != 0)
+			throw invalid_operation("Attempting to write on a read only stream.");
+
+		off_t position = ftello(mFile);
+
+		if (position < 0 || 0 != fflush(mFile))
+			throw std::runtime_error("Unknown file error.");
+
+		int file = fileno(mFile);
+		size_t total = totalSize(buffers);
+		size_t bytes_written = Detail::pwritev_all(file, buffers, static_cast<uint64_t>(position));
+
+		// Files created by open() are in append mode, where writes always go to the end
+		// of the file, so that is where the position is left.
+		int seek_result = (0 != (fcntl(file, F_GETFL) & O_APPEND)) ?
+			fseeko(mFile, 0, SEEK_END) :
+			fseeko(mFile, position + static_cast<off_t>(bytes_written), SEEK_SET);
+
+		if (0 != seek_result)
+			throw std::runtime_error("Unknown file error.");
+
+		if (bytes_written < total)
+			throw std::system_error(EIO, std::generic_category(), "File write made no progress.");
+	#endif
+	}
+
 	void FileStream::seek(size_t position)
 	{
 		long l_position = Number::convert<long>(position);
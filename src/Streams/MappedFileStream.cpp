@@ -0,0 +1,459 @@
+#include <StdExt/Streams/MappedFileStream.h>
+
+#include <StdExt/Exceptions.h>
+#include <StdExt/Utility.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+#if defined(STD_EXT_WIN32)
+#	define WIN32_LEAN_AND_MEAN
+#	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace StdExt::Streams
+{
+	/**
+	 * @internal
+	 * @brief
+	 *  Writable mappings grow in multiples of this size, which is a multiple of the page
+	 *  size on all supported platforms.
+	 */
+	static constexpr size_t MapGranularity = 64 * 1024;
+
+#if defined(STD_EXT_WIN32)
+	static void* const NoFile = INVALID_HANDLE_VALUE;
+#else
+	static constexpr int NoFile = -1;
+#endif
+
+	MappedFileStream::MappedFileStream()
+		: mFile(NoFile),
+	#if defined(STD_EXT_WIN32)
+		  mMapping(nullptr),
+	#endif
+		  mData(nullptr), mSize(0), mCapacity(0), mSeekPosition(0), mHint(AccessHint::Normal)
+	{
+	}
+
+	MappedFileStream::MappedFileStream(const String& path, bool readonly)
+		: MappedFileStream()
+	{
+		open(path, readonly);
+	}
+
+	MappedFileStream::MappedFileStream(MappedFileStream&& other) noexcept
+		: mFile(std::exchange(other.mFile, NoFile)),
+	#if defined(STD_EXT_WIN32)
+		  mMapping(std::exchange(other.mMapping, nullptr)),
+	#endif
+		  mData(std::exchange(other.mData, nullptr)),
+		  mSize(std::exchange(other.mSize, 0)),
+		  mCapacity(std::exchange(other.mCapacity, 0)),
+		  mSeekPosition(std::exchange(other.mSeekPosition, 0)),
+		  mHint(other.mHint)
+	{
+		setFlags(other.getFlags());
+	}
+
+	MappedFileStream::~MappedFileStream()
+	{
+		close();
+	}
+
+	MappedFileStream& MappedFileStream::operator=(MappedFileStream&& other) noexcept
+	{
+		if (this != &other)
+		{
+			close();
+
+			mFile = std::exchange(other.mFile, NoFile);
+		#if defined(STD_EXT_WIN32)
+			mMapping = std::exchange(other.mMapping, nullptr);
+		#endif
+			mData = std::exchange(other.mData, nullptr);
+			mSize = std::exchange(other.mSize, 0);
+			mCapacity = std::exchange(other.mCapacity, 0);
+			mSeekPosition = std::exchange(other.mSeekPosition, 0);
+			mHint = other.mHint;
+
+			setFlags(other.getFlags());
+		}
+
+		return *this;
+	}
+
+	void* MappedFileStream::dataPtr(size_t seekPos) const
+	{
+		if (nullptr == mData)
+			throw invalid_operation("Attempting to access an unmapped file.");
+
+		if (seekPos >= mSize)
+			throw out_of_range("Attempting to access outside the bounds of the file.");
+
+		return mData + seekPos;
+	}
+
+	void MappedFileStream::readRaw(void* destination, size_t byteLength)
+	{
+		if (!isOpen())
+			throw invalid_operation("Attempting to read on an unopened file.");
+
+		if (byteLength > mSize - mSeekPosition)
+			throw out_of_range("Attempted to read passed the end of the file.");
+
+		if (byteLength > 0)
+			memcpy(destination, mData + mSeekPosition, byteLength);
+
+		mSeekPosition += byteLength;
+	}
+
+	void MappedFileStream::writeRaw(const void* data, size_t byteLength)
+	{
+		if (!isOpen())
+			throw invalid_operation("Attempting to write on an unopened file.");
+
+		if ((getFlags() & READ_ONLY) != 0)
+			throw invalid_operation("Attempting to write on a read only stream.");
+
+		if (0 == byteLength)
+			return;
+
+		size_t end = mSeekPosition + byteLength;
+
+		if (end > mCapacity)
+			remap( nextMultipleOf(std::max(end, 2 * mCapacity), MapGranularity) );
+
+		memcpy(mData + mSeekPosition, data, byteLength);
+
+		mSeekPosition = end;
+		mSize = std::max(mSize, end);
+	}
+
+	void MappedFileStream::seek(size_t position)
+	{
+		if (!isOpen())
+			throw invalid_operation("Attempting to seek on an unopened file.");
+
+		if (position > mSize)
+			throw out_of_range("Attempted to seek outside the bounds of the file.");
+
+		mSeekPosition = position;
+	}
+
+	size_t MappedFileStream::getSeekPosition() const
+	{
+		return mSeekPosition;
+	}
+
+	size_t MappedFileStream::bytesAvailable() const
+	{
+		return mSize - mSeekPosition;
+	}
+
+	bool MappedFileStream::canRead(size_t numBytes)
+	{
+		return isOpen() && numBytes <= mSize - mSeekPosition;
+	}
+
+	bool MappedFileStream::canWrite(size_t numBytes, bool autoExpand)
+	{
+		if (!isOpen() || (getFlags() & READ_ONLY) != 0)
+			return false;
+
+		if (autoExpand)
+		{
+			try
+			{
+				reserve(mSeekPosition + numBytes);
+			}
+			catch (const std::exception&)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void MappedFileStream::clear()
+	{
+		if ((getFlags() & READ_ONLY) != 0)
+			throw invalid_operation("Attempting to clear a read-only file stream.");
+
+		mSize = 0;
+		mSeekPosition = 0;
+	}
+
+	bool MappedFileStream::open(const String& path, bool readonly)
+	{
+		if (isOpen())
+			return false;
+
+		setFlags(readonly ? (READ_ONLY | CAN_SEEK | MEMORY_BACKED) : (CAN_SEEK | MEMORY_BACKED));
+
+	#if defined(STD_EXT_WIN32)
+		std::wstring ntPath = convertString<wchar_t>(path).toStdString();
+
+		HANDLE file = CreateFileW(
+			ntPath.c_str(), readonly ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE),
+			FILE_SHARE_READ, nullptr, readonly ? OPEN_EXISTING : OPEN_ALWAYS,
+			FILE_ATTRIBUTE_NORMAL, nullptr
+		);
+
+		if (INVALID_HANDLE_VALUE == file)
+			throw std::runtime_error("Failed to open file.");
+
+		LARGE_INTEGER file_size;
+
+		if ( !GetFileSizeEx(file, &file_size) )
+		{
+			CloseHandle(file);
+			throw std::runtime_error("Failed to get the size of the file.");
+		}
+
+		mSize = static_cast<size_t>(file_size.QuadPart);
+	#else
+		std::filesystem::path f_path(path.view());
+
+		int file = ::open(f_path.c_str(), readonly ? O_RDONLY : (O_RDWR | O_CREAT), 0666);
+
+		if (file < 0)
+			throw std::runtime_error("Failed to open file.");
+
+		struct stat file_stat;
+
+		if (0 != fstat(file, &file_stat))
+		{
+			::close(file);
+			throw std::runtime_error("Failed to get the size of the file.");
+		}
+
+		mSize = static_cast<size_t>(file_stat.st_size);
+	#endif
+
+		mFile = file;
+		mSeekPosition = 0;
+
+		try
+		{
+			mapFile(mSize);
+		}
+		catch (...)
+		{
+		#if defined(STD_EXT_WIN32)
+			CloseHandle(mFile);
+		#else
+			::close(mFile);
+		#endif
+
+			mFile = NoFile;
+			mSize = 0;
+
+			throw;
+		}
+
+		return true;
+	}
+
+	void MappedFileStream::close()
+	{
+		if (!isOpen())
+			return;
+
+		unmapFile();
+
+		// Drop space that was mapped ahead of writes.
+		if ((getFlags() & READ_ONLY) == 0)
+		{
+		#if defined(STD_EXT_WIN32)
+			LARGE_INTEGER file_size;
+			file_size.QuadPart = static_cast<LONGLONG>(mSize);
+
+			if ( SetFilePointerEx(mFile, file_size, nullptr, FILE_BEGIN) )
+				SetEndOfFile(mFile);
+		#else
+			[[maybe_unused]] int result = ftruncate(mFile, static_cast<off_t>(mSize));
+		#endif
+		}
+
+	#if defined(STD_EXT_WIN32)
+		CloseHandle(mFile);
+	#else
+		::close(mFile);
+	#endif
+
+		mFile = NoFile;
+		mSize = 0;
+		mSeekPosition = 0;
+	}
+
+	bool MappedFileStream::isOpen() const
+	{
+		return NoFile != mFile;
+	}
+
+	size_t MappedFileStream::size() const
+	{
+		return mSize;
+	}
+
+	void MappedFileStream::reserve(size_t capacity)
+	{
+		if ((getFlags() & READ_ONLY) != 0)
+			throw invalid_operation("Attempting to grow a read-only file stream.");
+
+		if (!isOpen())
+			throw invalid_operation("Attempting to grow an unopened file.");
+
+		if (capacity > mCapacity)
+			remap( nextMultipleOf(capacity, MapGranularity) );
+	}
+
+	void MappedFileStream::adviseAccess(AccessHint hint)
+	{
+		mHint = hint;
+		applyHint();
+	}
+
+	void MappedFileStream::flush()
+	{
+		if (nullptr == mData || (getFlags() & READ_ONLY) != 0)
+			return;
+
+	#if defined(STD_EXT_WIN32)
+		if ( !FlushViewOfFile(mData, 0) || !FlushFileBuffers(mFile) )
+			throw std::runtime_error("Failed to flush the file.");
+	#else
+		if (0 != msync(mData, mCapacity, MS_SYNC))
+			throw std::runtime_error("Failed to flush the file.");
+	#endif
+	}
+
+	void MappedFileStream::mapFile(size_t capacity)
+	{
+		if (0 == capacity)
+			return;
+
+		bool writable = (getFlags() & READ_ONLY) == 0;
+
+	#if defined(STD_EXT_WIN32)
+		// Creating a writable mapping larger than the file grows the file.
+		HANDLE mapping = CreateFileMappingW(
+			mFile, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+			static_cast<DWORD>(static_cast<uint64_t>(capacity) >> 32),
+			static_cast<DWORD>(capacity & 0xFFFFFFFF), nullptr
+		);
+
+		if (nullptr == mapping)
+			throw std::runtime_error("Failed to map file.");
+
+		void* view = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, capacity);
+
+		if (nullptr == view)
+		{
+			CloseHandle(mapping);
+			throw std::runtime_error("Failed to map file.");
+		}
+
+		mMapping = mapping;
+	#else
+		void* view = mmap(nullptr, capacity, PROT_READ | (writable ? PROT_WRITE : 0), MAP_SHARED, mFile, 0);
+
+		if (MAP_FAILED == view)
+			throw std::runtime_error("Failed to map file.");
+	#endif
+
+		mData = static_cast<std::byte*>(view);
+		mCapacity = capacity;
+
+		applyHint();
+	}
+
+	void MappedFileStream::unmapFile() noexcept
+	{
+		if (nullptr == mData)
+			return;
+
+	#if defined(STD_EXT_WIN32)
+		UnmapViewOfFile(mData);
+		CloseHandle(mMapping);
+		mMapping = nullptr;
+	#else
+		munmap(mData, mCapacity);
+	#endif
+
+		mData = nullptr;
+		mCapacity = 0;
+	}
+
+	void MappedFileStream::remap(size_t capacity)
+	{
+	#if defined(STD_EXT_WIN32)
+		unmapFile();
+		mapFile(capacity);
+	#else
+		// Mapped pages past the end of the file cannot be accessed, so the file is grown
+		// to cover the whole mapping.
+		if (0 != ftruncate(mFile, static_cast<off_t>(capacity)))
+			throw std::runtime_error("Failed to grow the file.");
+
+		#if defined(STD_EXT_LINUX)
+			if (nullptr != mData)
+			{
+				void* view = mremap(mData, mCapacity, capacity, MREMAP_MAYMOVE);
+
+				if (MAP_FAILED == view)
+					throw std::runtime_error("Failed to grow the file mapping.");
+
+				mData = static_cast<std::byte*>(view);
+				mCapacity = capacity;
+
+				applyHint();
+				return;
+			}
+		#endif
+
+		unmapFile();
+		mapFile(capacity);
+	#endif
+	}
+
+	void MappedFileStream::applyHint()
+	{
+	#if !defined(STD_EXT_WIN32)
+		if (nullptr == mData)
+			return;
+
+		int advice = MADV_NORMAL;
+
+		switch (mHint)
+		{
+		case AccessHint::Sequential:
+			advice = MADV_SEQUENTIAL;
+			break;
+		case AccessHint::Random:
+			advice = MADV_RANDOM;
+			break;
+		case AccessHint::WillNeed:
+			advice = MADV_WILLNEED;
+			break;
+		default:
+			break;
+		}
+
+		// The advice only affects performance, so failure is not an error.
+		madvise(mData, mCapacity, advice);
+	#endif
+	}
+}
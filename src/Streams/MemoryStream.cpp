@@ -23,7 +23,7 @@ namespace StdExt::Streams
 		if (nullptr == beginning)
 			throw std::invalid_argument("Parameter beginning cannot be null.");
 
-		setFlags(MEMORY_BACKED | CAN_SEEK);
+		setFlags(READ_ONLY | MEMORY_BACKED | CAN_SEEK);
 
 		mData = const_cast<void*>(beginning);
 		mSize = (nullptr != mData) ? size : 0;
@@ -68,6 +68,7 @@ namespace StdExt::Streams
 				memcpy(destination, &((char*)mData)[mSeekPosition], byteLength);
 			
 			mSeekPosition += byteLength;
+			return;
 		}
 
 		throw out_of_range("Attempted to read passed the end of the MemoryStream.");
@@ -124,12 +125,12 @@ namespace StdExt::Streams
 		if (nullptr == mData)
 			return false;
 
-		return ((getFlags() | READ_ONLY) == 0) ? ((mSeekPosition + numBytes) <= mSize) : false;
+		return ((getFlags() & READ_ONLY) == 0) ? ((mSeekPosition + numBytes) <= mSize) : false;
 	}
 
 	void MemoryStream::clear()
 	{
-		if ((getFlags() | READ_ONLY) != 0)
+		if ((getFlags() & READ_ONLY) != 0)
 			throw invalid_operation("Attepmted to clear a read-only stream.");
 
 		seek(0);
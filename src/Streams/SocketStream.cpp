@@ -55,6 +55,48 @@ namespace StdExt::Streams
 		std::memcpy(expandForWrite(byteLength), data, byteLength);
 	}
 
+	void SocketStream::readVec(std::span<const MutableBuffer> buffers)
+	{
+		size_t total = totalSize(buffers);
+
+		if (0 == total)
+			return;
+
+		if (mWriteMarker - mReadMarker < total)
+			throw std::out_of_range("Not enough data on bytestream to complete read request.");
+
+		std::byte* byte_ptr = access_as<std::byte*>(mBuffer.data());
+
+		for (const MutableBuffer& buffer : buffers)
+		{
+			if (0 < buffer.size)
+			{
+				std::memcpy(buffer.data, &byte_ptr[mReadMarker], buffer.size);
+				mReadMarker += buffer.size;
+			}
+		}
+
+		if ( mReadMarker == mWriteMarker )
+		{
+			mWriteMarker = 0;
+			mReadMarker = 0;
+		}
+	}
+
+	void SocketStream::writeVec(std::span<const ConstBuffer> buffers)
+	{
+		std::byte* out = access_as<std::byte*>(expandForWrite(totalSize(buffers)));
+
+		for (const ConstBuffer& buffer : buffers)
+		{
+			if (0 < buffer.size)
+			{
+				std::memcpy(out, buffer.data, buffer.size);
+				out += buffer.size;
+			}
+		}
+	}
+
 	size_t SocketStream::bytesAvailable() const
 	{
 		return mWriteMarker - mReadMarker;
@@ -0,0 +1,108 @@
+#include "VectoredIO.h"
+
+#if !defined(STD_EXT_WIN32)
+
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+namespace StdExt::Streams::Detail
+{
+	/**
+	 * @internal
+	 * @brief
+	 *  Number of buffers passed to the kernel by a single call, well below IOV_MAX on
+	 *  all supported platforms.
+	 */
+	static constexpr size_t IoVecBatch = 64;
+
+	template<typename buffer_t, typename transfer_t>
+	static size_t transfer_all(std::span<const buffer_t> buffers, uint64_t offset, const transfer_t& transfer)
+	{
+		using byte_t = std::conditional_t<std::is_same_v<buffer_t, ConstBuffer>, const std::byte, std::byte>;
+
+		size_t total = 0;
+		size_t index = 0;
+		size_t partial = 0;
+
+		while (true)
+		{
+			iovec batch[IoVecBatch];
+			int count = 0;
+
+			for (size_t i = index; i < buffers.size() && count < static_cast<int>(IoVecBatch); ++i)
+			{
+				size_t skip = (i == index) ? partial : 0;
+
+				if (buffers[i].size == skip)
+					continue;
+
+				batch[count].iov_base = const_cast<std::byte*>(static_cast<byte_t*>(buffers[i].data) + skip);
+				batch[count].iov_len = buffers[i].size - skip;
+				++count;
+			}
+
+			if (0 == count)
+				return total;
+
+			ssize_t result = transfer(batch, count, static_cast<off_t>(offset + total));
+
+			if (result < 0)
+			{
+				if (EINTR == errno)
+					continue;
+
+				throw std::system_error(errno, std::generic_category(), "Unknown file error.");
+			}
+
+			if (0 == result)
+				return total;
+
+			total += static_cast<size_t>(result);
+
+			// Move past the buffers that were completed, which includes any that are empty.
+			size_t remaining = static_cast<size_t>(result);
+
+			while (index < buffers.size())
+			{
+				size_t left_in_buffer = buffers[index].size - partial;
+
+				if (left_in_buffer > remaining)
+				{
+					partial += remaining;
+					break;
+				}
+
+				remaining -= left_in_buffer;
+				partial = 0;
+				++index;
+			}
+		}
+	}
+
+	size_t preadv_all(int file, std::span<const MutableBuffer> buffers, uint64_t offset)
+	{
+		return transfer_all(buffers, offset,
+			[file](const iovec* batch, int count, off_t position)
+			{
+				return preadv(file, batch, count, position);
+			}
+		);
+	}
+
+	size_t pwritev_all(int file, std::span<const ConstBuffer> buffers, uint64_t offset)
+	{
+		return transfer_all(buffers, offset,
+			[file](const iovec* batch, int count, off_t position)
+			{
+				return pwritev(file, batch, count, position);
+			}
+		);
+	}
+}
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef _STD_EXT_SRC_STREAMS_VECTORED_IO_H_
+#define _STD_EXT_SRC_STREAMS_VECTORED_IO_H_
+
+#include <StdExt/Streams/ByteStream.h>
+
+#include <cstdint>
+#include <span>
+
+namespace StdExt::Streams::Detail
+{
+#if !defined(STD_EXT_WIN32)
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Reads into <i>buffers</i> from <i>file</i> starting at <i>offset</i> with preadv(),
+	 *  continuing after partial reads, and returns the number of bytes read.  Fewer bytes
+	 *  are read only when the end of the file is reached.
+	 */
+	size_t preadv_all(int file, std::span<const MutableBuffer> buffers, uint64_t offset);
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Writes all of <i>buffers</i> to <i>file</i> starting at <i>offset</i> with
+	 *  pwritev(), continuing after partial writes, and returns the number of bytes
+	 *  written.
+	 */
+	size_t pwritev_all(int file, std::span<const ConstBuffer> buffers, uint64_t offset);
+
+#endif
+}
+
+#endif // !_STD_EXT_SRC_STREAMS_VECTORED_IO_H_
@@ -2,6 +2,7 @@
 
 #include <StdExt/String.h>
 #include <StdExt/Number.h>
+#include <StdExt/Unicode.h>
 #include <StdExt/Utility.h>
 
 #include <StdExt/Collections/Vector.h>
@@ -224,6 +225,45 @@ namespace StdExt
 		);
 	}
 
+	using Unicode::unicode_unit_t;
+
+	/**
+	 * @internal
+	 * @brief
+	 *  Converts between unicode encodings using the native transcoder.  The exact
+	 *  output size is calculated first so that the result is written directly
+	 *  into either the small memory of the string or a single shared allocation.
+	 */
+	template<Character to_t, Character from_t>
+	static StringBase<to_t> transcode(const StringBase<from_t>& str)
+	{
+		using to_unit_t = unicode_unit_t<to_t>;
+		using from_unit_t = unicode_unit_t<from_t>;
+
+		if (str.size() == 0)
+			return StringBase<to_t>();
+
+		std::basic_string_view<from_unit_t> in_view(
+			access_as<const from_unit_t*>(str.data()), str.size()
+		);
+
+		size_t length = Unicode::transcodedLength<to_unit_t>(in_view);
+
+		if (length <= StringBase<to_t>::SmallSize)
+		{
+			std::array<to_t, StringBase<to_t>::SmallSize> out_chars;
+			Unicode::transcode(in_view, access_as<to_unit_t*>(out_chars.data()));
+
+			return StringBase<to_t>(out_chars.data(), length);
+		}
+
+		typename StringBase<to_t>::shared_array_t memory(length + 1);
+		Unicode::transcode(in_view, access_as<to_unit_t*>(memory.data()));
+		memory[length] = 0;
+
+		return StringBase<to_t>(std::move(memory));
+	}
+
 	template<>
 	StringBase<char> convertString<char>(const StringBase<char>& str)
 	{
@@ -317,25 +357,19 @@ namespace StdExt
 	template<>
 	StringBase<char8_t> convertString<char8_t>(const StringBase<char16_t>& str)
 	{
-		return convert<char8_t>(str);
+		return transcode<char8_t>(str);
 	}
 
 	template<>
 	StringBase<char8_t> convertString<char8_t>(const StringBase<char32_t>& str)
 	{
-		return convert<char8_t>(str);
+		return transcode<char8_t>(str);
 	}
 
 	template<>
 	StringBase<char8_t> convertString<char8_t>(const StringBase<wchar_t>& str)
-	{	
-		#ifdef USE_ICONV
-		return iconvert<char8_t>(str);
-		#else
-		return convertString<char8_t>(
-			convertString<char>(str)
-		);
-		#endif
+	{
+		return transcode<char8_t>(str);
 	}
 
 
@@ -351,7 +385,7 @@ namespace StdExt
 	template<>
 	StringBase<char16_t> convertString<char16_t>(const StringBase<char8_t>& str)
 	{
-		return convert<char16_t>(str);
+		return transcode<char16_t>(str);
 	}
 
 	template<>
@@ -363,21 +397,13 @@ namespace StdExt
 	template<>
 	StringBase<char16_t> convertString<char16_t>(const StringBase<char32_t>& str)
 	{
-		return convert<char16_t>(
-			convert<char8_t>(str)
-		);
+		return transcode<char16_t>(str);
 	}
 
 	template<>
 	StringBase<char16_t> convertString<char16_t>(const StringBase<wchar_t>& str)
 	{
-		#ifdef USE_ICONV
-		return iconvert<char16_t>(str);
-		#else
-		return convertString<char16_t>(
-			convertString<char>(str)
-		);
-		#endif
+		return transcode<char16_t>(str);
 	}
 
 #ifndef STD_EXT_APPLE
@@ -446,15 +472,13 @@ namespace StdExt
 	template<>
 	StringBase<char32_t> convertString<char32_t>(const StringBase<char8_t>& str)
 	{
-		return convert<char32_t>(str);
+		return transcode<char32_t>(str);
 	}
 
 	template<>
 	StringBase<char32_t> convertString<char32_t>(const StringBase<char16_t>& str)
 	{
-		return convert<char32_t>(
-			convert<char8_t>(str)
-		);
+		return transcode<char32_t>(str);
 	}
 
 	template<>
@@ -466,13 +490,7 @@ namespace StdExt
 	template<>
 	StringBase<char32_t> convertString<char32_t>(const StringBase<wchar_t>& str)
 	{
-		#ifdef USE_ICONV
-		return iconvert<char32_t>(str);
-		#else
-		return convertString<char32_t>(
-			convertString<char>(str)
-		);
-		#endif
+		return transcode<char32_t>(str);
 	}
 
 	template<>
@@ -484,37 +502,19 @@ namespace StdExt
 	template<>
 	StringBase<wchar_t> convertString<wchar_t>(const StringBase<char8_t>& str)
 	{
-		#ifdef USE_ICONV
-		return iconvert<wchar_t>(str);
-		#else
-		return convertString<wchar_t>(
-			convertString<char32_t>(str)
-		);
-		#endif
+		return transcode<wchar_t>(str);
 	}
 
 	template<>
 	StringBase<wchar_t> convertString<wchar_t>(const StringBase<char16_t>& str)
 	{
-		#ifdef USE_ICONV
-		return iconvert<wchar_t>(str);
-		#else
-		return convertString<wchar_t>(
-			convertString<char32_t>(str)
-		);
-		#endif
+		return transcode<wchar_t>(str);
 	}
 
 	template<>
 	StringBase<wchar_t> convertString<wchar_t>(const StringBase<char32_t>& str)
 	{
-		#ifdef USE_ICONV
-		return iconvert<wchar_t>(str);
-		#else
-		return convert<wchar_t>(
-			convertString<char>(str)
-		);
-		#endif
+		return transcode<wchar_t>(str);
 	}
 
 	template<>
@@ -0,0 +1,1111 @@
+#include <StdExt/Unicode.h>
+
+#include <StdExt/Platform.h>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(STD_EXT_SSE2)
+#	include <emmintrin.h>
+#endif
+
+#if defined(STD_EXT_AVX2)
+#	include <immintrin.h>
+#endif
+
+namespace StdExt::Unicode
+{
+	encoding_error::encoding_error(const char* message, size_t offset)
+		: format_error(message), mOffset(offset)
+	{
+	}
+
+	encoding_error::encoding_error(const std::string& message, size_t offset)
+		: format_error(message), mOffset(offset)
+	{
+	}
+
+	size_t encoding_error::offset() const noexcept
+	{
+		return mOffset;
+	}
+
+	//////////////////////////////
+
+	namespace
+	{
+		/**
+		 * @internal
+		 * @brief
+		 *  A decoded code point and the number of code units it occupied.  A length
+		 *  of zero indicates an invalid sequence.
+		 */
+		struct Decoded
+		{
+			char32_t codePoint;
+			uint32_t length;
+		};
+
+		constexpr Decoded Invalid{ 0, 0 };
+
+		constexpr bool isContinuation(char8_t unit) noexcept
+		{
+			return (unit & 0xC0) == 0x80;
+		}
+
+		constexpr bool isSurrogate(char32_t code_point) noexcept
+		{
+			return (code_point >= 0xD800 && code_point <= 0xDFFF);
+		}
+
+		Decoded decode(const char8_t* str, size_t remaining) noexcept
+		{
+			char32_t lead = str[0];
+
+			if (lead < 0x80)
+				return { lead, 1 };
+
+			// Continuation bytes and overlong two byte sequences.
+			if (lead < 0xC2)
+				return Invalid;
+
+			if (lead < 0xE0)
+			{
+				if (remaining < 2 || !isContinuation(str[1]))
+					return Invalid;
+
+				return { ((lead & 0x1F) << 6) | (str[1] & 0x3F), 2 };
+			}
+
+			if (lead < 0xF0)
+			{
+				if (remaining < 3 || !isContinuation(str[1]) || !isContinuation(str[2]))
+					return Invalid;
+
+				char32_t code_point =
+					((lead & 0x0F) << 12) | ((str[1] & 0x3F) << 6) | (str[2] & 0x3F);
+
+				if (code_point < 0x800 || isSurrogate(code_point))
+					return Invalid;
+
+				return { code_point, 3 };
+			}
+
+			if (lead < 0xF5)
+			{
+				if ( remaining < 4 || !isContinuation(str[1]) ||
+				     !isContinuation(str[2]) || !isContinuation(str[3]) )
+				{
+					return Invalid;
+				}
+
+				char32_t code_point =
+					((lead & 0x07) << 18) | ((str[1] & 0x3F) << 12) |
+					((str[2] & 0x3F) << 6) | (str[3] & 0x3F);
+
+				if (code_point < 0x10000 || code_point > MaxCodePoint)
+					return Invalid;
+
+				return { code_point, 4 };
+			}
+
+			return Invalid;
+		}
+
+		Decoded decode(const char16_t* str, size_t remaining) noexcept
+		{
+			char32_t lead = str[0];
+
+			if ( !isSurrogate(lead) )
+				return { lead, 1 };
+
+			if (lead > 0xDBFF || remaining < 2)
+				return Invalid;
+
+			char32_t trail = str[1];
+
+			if (trail < 0xDC00 || trail > 0xDFFF)
+				return Invalid;
+
+			return { 0x10000 + ((lead - 0xD800) << 10) + (trail - 0xDC00), 2 };
+		}
+
+		Decoded decode(const char32_t* str, [[maybe_unused]] size_t remaining) noexcept
+		{
+			char32_t code_point = str[0];
+
+			if (code_point > MaxCodePoint || isSurrogate(code_point))
+				return Invalid;
+
+			return { code_point, 1 };
+		}
+
+		template<UnicodeCharacter to_t>
+		constexpr size_t encodedLength(char32_t code_point) noexcept
+		{
+			if constexpr ( std::same_as<to_t, char8_t> )
+			{
+				if (code_point < 0x80)
+					return 1;
+				else if (code_point < 0x800)
+					return 2;
+				else if (code_point < 0x10000)
+					return 3;
+				else
+					return 4;
+			}
+			else if constexpr ( std::same_as<to_t, char16_t> )
+			{
+				return (code_point < 0x10000) ? 1 : 2;
+			}
+			else
+			{
+				return 1;
+			}
+		}
+
+		size_t encode(char32_t code_point, char8_t* out) noexcept
+		{
+			if (code_point < 0x80)
+			{
+				out[0] = static_cast<char8_t>(code_point);
+				return 1;
+			}
+			else if (code_point < 0x800)
+			{
+				out[0] = static_cast<char8_t>(0xC0 | (code_point >> 6));
+				out[1] = static_cast<char8_t>(0x80 | (code_point & 0x3F));
+				return 2;
+			}
+			else if (code_point < 0x10000)
+			{
+				out[0] = static_cast<char8_t>(0xE0 | (code_point >> 12));
+				out[1] = static_cast<char8_t>(0x80 | ((code_point >> 6) & 0x3F));
+				out[2] = static_cast<char8_t>(0x80 | (code_point & 0x3F));
+				return 3;
+			}
+			else
+			{
+				out[0] = static_cast<char8_t>(0xF0 | (code_point >> 18));
+				out[1] = static_cast<char8_t>(0x80 | ((code_point >> 12) & 0x3F));
+				out[2] = static_cast<char8_t>(0x80 | ((code_point >> 6) & 0x3F));
+				out[3] = static_cast<char8_t>(0x80 | (code_point & 0x3F));
+				return 4;
+			}
+		}
+
+		size_t encode(char32_t code_point, char16_t* out) noexcept
+		{
+			if (code_point < 0x10000)
+			{
+				out[0] = static_cast<char16_t>(code_point);
+				return 1;
+			}
+
+			code_point -= 0x10000;
+			out[0] = static_cast<char16_t>(0xD800 + (code_point >> 10));
+			out[1] = static_cast<char16_t>(0xDC00 + (code_point & 0x3FF));
+
+			return 2;
+		}
+
+		size_t encode(char32_t code_point, char32_t* out) noexcept
+		{
+			out[0] = code_point;
+			return 1;
+		}
+
+	#if defined(STD_EXT_SSE2)
+		/**
+		 * @internal
+		 * @brief
+		 *  A vector with the bits set that must be clear in code units of char_t
+		 *  for them to be ASCII.
+		 */
+		template<UnicodeCharacter char_t>
+		__m128i nonAsciiMask128() noexcept
+		{
+			if constexpr (sizeof(char_t) == 1)
+				return _mm_set1_epi8(static_cast<char>(0x80));
+			else if constexpr (sizeof(char_t) == 2)
+				return _mm_set1_epi16(static_cast<short>(0xFF80));
+			else
+				return _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+		}
+	#endif
+
+	#if defined(STD_EXT_AVX2)
+		template<UnicodeCharacter char_t>
+		__m256i nonAsciiMask256() noexcept
+		{
+			if constexpr (sizeof(char_t) == 1)
+				return _mm256_set1_epi8(static_cast<char>(0x80));
+			else if constexpr (sizeof(char_t) == 2)
+				return _mm256_set1_epi16(static_cast<short>(0xFF80));
+			else
+				return _mm256_set1_epi32(static_cast<int>(0xFFFFFF80));
+		}
+	#endif
+
+		template<UnicodeCharacter char_t>
+		size_t asciiRun(const char_t* str, size_t count) noexcept
+		{
+			size_t index = 0;
+
+		#if defined(STD_EXT_AVX2)
+			{
+				constexpr size_t step = sizeof(__m256i) / sizeof(char_t);
+				const __m256i mask = nonAsciiMask256<char_t>();
+				const __m256i zero = _mm256_setzero_si256();
+
+				for (; index + step <= count; index += step)
+				{
+					__m256i units = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + index));
+					__m256i high_bits = _mm256_and_si256(units, mask);
+
+					uint32_t non_ascii_bytes = ~static_cast<uint32_t>(
+						_mm256_movemask_epi8(_mm256_cmpeq_epi8(high_bits, zero))
+					);
+
+					if (0 != non_ascii_bytes)
+						return index + std::countr_zero(non_ascii_bytes) / sizeof(char_t);
+				}
+			}
+		#endif
+
+		#if defined(STD_EXT_SSE2)
+			{
+				constexpr size_t step = sizeof(__m128i) / sizeof(char_t);
+				const __m128i mask = nonAsciiMask128<char_t>();
+				const __m128i zero = _mm_setzero_si128();
+
+				for (; index + step <= count; index += step)
+				{
+					__m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + index));
+					__m128i high_bits = _mm_and_si128(units, mask);
+
+					uint32_t non_ascii_bytes = 0xFFFF & ~static_cast<uint32_t>(
+						_mm_movemask_epi8(_mm_cmpeq_epi8(high_bits, zero))
+					);
+
+					if (0 != non_ascii_bytes)
+						return index + std::countr_zero(non_ascii_bytes) / sizeof(char_t);
+				}
+			}
+		#endif
+
+			while (index < count && static_cast<uint32_t>(str[index]) < 0x80)
+				++index;
+
+			return index;
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Copies a run of ASCII code units, widening or narrowing them as needed.
+		 */
+		template<UnicodeCharacter to_t, UnicodeCharacter from_t>
+		void copyAscii(const from_t* source, to_t* destination, size_t count) noexcept
+		{
+			if constexpr (sizeof(to_t) == sizeof(from_t))
+			{
+				memcpy(destination, source, count * sizeof(to_t));
+			}
+			else
+			{
+				size_t index = 0;
+
+			#if defined(STD_EXT_SSE2)
+				if constexpr (sizeof(from_t) == 1 && sizeof(to_t) == 2)
+				{
+					const __m128i zero = _mm_setzero_si128();
+
+					for (; index + 16 <= count; index += 16)
+					{
+						__m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index));
+						__m128i* out = reinterpret_cast<__m128i*>(destination + index);
+
+						_mm_storeu_si128(out, _mm_unpacklo_epi8(narrow, zero));
+						_mm_storeu_si128(out + 1, _mm_unpackhi_epi8(narrow, zero));
+					}
+				}
+				else if constexpr (sizeof(from_t) == 2 && sizeof(to_t) == 1)
+				{
+					for (; index + 16 <= count; index += 16)
+					{
+						const __m128i* in = reinterpret_cast<const __m128i*>(source + index);
+
+						__m128i narrow = _mm_packus_epi16(
+							_mm_loadu_si128(in), _mm_loadu_si128(in + 1)
+						);
+
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + index), narrow);
+					}
+				}
+			#endif
+
+				for (; index < count; ++index)
+					destination[index] = static_cast<to_t>(source[index]);
+			}
+		}
+
+		template<UnicodeCharacter char_t>
+		size_t invalidOffset(std::basic_string_view<char_t> str) noexcept
+		{
+			const char_t* data = str.data();
+			size_t count = str.size();
+			size_t index = 0;
+
+			while (index < count)
+			{
+				index += asciiRun(data + index, count - index);
+
+				while (index < count && static_cast<uint32_t>(data[index]) >= 0x80)
+				{
+					Decoded decoded = decode(data + index, count - index);
+
+					if (0 == decoded.length)
+						return index;
+
+					index += decoded.length;
+				}
+			}
+
+			return std::basic_string_view<char_t>::npos;
+		}
+
+		[[noreturn]] void throwInvalid(size_t offset)
+		{
+			throw encoding_error("Invalid unicode sequence.", offset);
+		}
+	}
+
+	size_t asciiLength(std::u8string_view str) noexcept
+	{
+		return asciiRun(str.data(), str.size());
+	}
+
+	size_t asciiLength(std::u16string_view str) noexcept
+	{
+		return asciiRun(str.data(), str.size());
+	}
+
+	size_t asciiLength(std::u32string_view str) noexcept
+	{
+		return asciiRun(str.data(), str.size());
+	}
+
+	size_t findInvalid(std::u8string_view str) noexcept
+	{
+		return invalidOffset(str);
+	}
+
+	size_t findInvalid(std::u16string_view str) noexcept
+	{
+		return invalidOffset(str);
+	}
+
+	size_t findInvalid(std::u32string_view str) noexcept
+	{
+		return invalidOffset(str);
+	}
+
+	template<UnicodeCharacter to_t, UnicodeCharacter from_t>
+	size_t transcodedLength(std::basic_string_view<from_t> str)
+	{
+		if constexpr ( std::same_as<to_t, from_t> )
+		{
+			size_t invalid_offset = invalidOffset(str);
+
+			if (invalid_offset != str.npos)
+				throwInvalid(invalid_offset);
+
+			return str.size();
+		}
+		else
+		{
+			const from_t* data = str.data();
+			size_t count = str.size();
+			size_t index = 0;
+			size_t length = 0;
+
+			while (index < count)
+			{
+				size_t ascii_count = asciiRun(data + index, count - index);
+				index += ascii_count;
+				length += ascii_count;
+
+				while (index < count && static_cast<uint32_t>(data[index]) >= 0x80)
+				{
+					Decoded decoded = decode(data + index, count - index);
+
+					if (0 == decoded.length)
+						throwInvalid(index);
+
+					length += encodedLength<to_t>(decoded.codePoint);
+					index += decoded.length;
+				}
+			}
+
+			return length;
+		}
+	}
+
+	template<UnicodeCharacter to_t, UnicodeCharacter from_t>
+	size_t transcode(std::basic_string_view<from_t> str, to_t* out)
+	{
+		const from_t* data = str.data();
+		size_t count = str.size();
+		size_t index = 0;
+		size_t written = 0;
+
+		while (index < count)
+		{
+			size_t ascii_count = asciiRun(data + index, count - index);
+			copyAscii(data + index, out + written, ascii_count);
+
+			index += ascii_count;
+			written += ascii_count;
+
+			while (index < count && static_cast<uint32_t>(data[index]) >= 0x80)
+			{
+				Decoded decoded = decode(data + index, count - index);
+
+				if (0 == decoded.length)
+					throwInvalid(index);
+
+				if constexpr ( std::same_as<to_t, from_t> )
+				{
+					memcpy(out + written, data + index, decoded.length * sizeof(to_t));
+					written += decoded.length;
+				}
+				else
+				{
+					written += encode(decoded.codePoint, out + written);
+				}
+
+				index += decoded.length;
+			}
+		}
+
+		return written;
+	}
+
+	template size_t transcodedLength<char8_t, char8_t>(std::u8string_view);
+	template size_t transcodedLength<char8_t, char16_t>(std::u16string_view);
+	template size_t transcodedLength<char8_t, char32_t>(std::u32string_view);
+	template size_t transcodedLength<char16_t, char8_t>(std::u8string_view);
+	template size_t transcodedLength<char16_t, char16_t>(std::u16string_view);
+	template size_t transcodedLength<char16_t, char32_t>(std::u32string_view);
+	template size_t transcodedLength<char32_t, char8_t>(std::u8string_view);
+	template size_t transcodedLength<char32_t, char16_t>(std::u16string_view);
+	template size_t transcodedLength<char32_t, char32_t>(std::u32string_view);
+
+	template size_t transcode<char8_t, char8_t>(std::u8string_view, char8_t*);
+	template size_t transcode<char8_t, char16_t>(std::u16string_view, char8_t*);
+	template size_t transcode<char8_t, char32_t>(std::u32string_view, char8_t*);
+	template size_t transcode<char16_t, char8_t>(std::u8string_view, char16_t*);
+	template size_t transcode<char16_t, char16_t>(std::u16string_view, char16_t*);
+	template size_t transcode<char16_t, char32_t>(std::u32string_view, char16_t*);
+	template size_t transcode<char32_t, char8_t>(std::u8string_view, char32_t*);
+	template size_t transcode<char32_t, char16_t>(std::u16string_view, char32_t*);
+	template size_t transcode<char32_t, char32_t>(std::u32string_view, char32_t*);
+
+	//////////////////////////////
+
+	char32_t toLower(char32_t code_point) noexcept
+	{
+		char32_t cp = code_point;
+
+		if (cp < 0x80)
+			return (cp - U'A' < 26) ? cp + 0x20 : cp;
+
+		if (cp < 0x100)
+			return (cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) ? cp + 0x20 : cp;
+
+		if (cp < 0x180)
+		{
+			if (0x178 == cp)
+				return 0xFF;
+
+			// Dotted and dotless I change encoded length, and the rest have no mapping.
+			if (0x130 == cp || 0x131 == cp || 0x138 == cp || 0x149 == cp || 0x17F == cp)
+				return cp;
+
+			// Letter pairs have the upper case letter at the even code point, except
+			// for these two ranges.
+			uint32_t upper_parity = ((cp >= 0x139 && cp <= 0x148) || cp >= 0x179) ? 1 : 0;
+			return ((cp & 1) == upper_parity) ? cp + 1 : cp;
+		}
+
+		if (cp >= 0x386 && cp <= 0x3AB)
+		{
+			if (cp >= 0x391 && cp != 0x3A2)
+				return cp + 0x20;
+
+			if (0x386 == cp)
+				return 0x3AC;
+
+			if (cp >= 0x388 && cp <= 0x38A)
+				return cp + 0x25;
+
+			if (0x38C == cp)
+				return 0x3CC;
+
+			if (0x38E == cp || 0x38F == cp)
+				return cp + 0x3F;
+
+			return cp;
+		}
+
+		if (cp >= 0x400 && cp < 0x530)
+		{
+			if (cp < 0x410)
+				return cp + 0x50;
+
+			if (cp < 0x430)
+				return cp + 0x20;
+
+			if (0x4C0 == cp)
+				return 0x4CF;
+
+			if (cp >= 0x4C1 && cp <= 0x4CE)
+				return (cp & 1) ? cp + 1 : cp;
+
+			if ((cp >= 0x460 && cp <= 0x481) || cp >= 0x48A)
+				return (cp & 1) ? cp : cp + 1;
+
+			return cp;
+		}
+
+		if (cp >= 0x531 && cp <= 0x556)
+			return cp + 0x30;
+
+		if ((cp >= 0x1E00 && cp <= 0x1E95) || (cp >= 0x1EA0 && cp <= 0x1EFF))
+			return (cp & 1) ? cp : cp + 1;
+
+		if (cp >= 0xFF21 && cp <= 0xFF3A)
+			return cp + 0x20;
+
+		if (cp >= 0x10400 && cp <= 0x10427)
+			return cp + 0x28;
+
+		return cp;
+	}
+
+	char32_t toUpper(char32_t code_point) noexcept
+	{
+		char32_t cp = code_point;
+
+		if (cp < 0x80)
+			return (cp - U'a' < 26) ? cp - 0x20 : cp;
+
+		if (cp < 0x100)
+		{
+			if (0xFF == cp)
+				return 0x178;
+
+			return (cp >= 0xE0 && cp <= 0xFE && cp != 0xF7) ? cp - 0x20 : cp;
+		}
+
+		if (cp < 0x180)
+		{
+			if (0x130 == cp || 0x131 == cp || 0x138 == cp || 0x149 == cp || 0x17F == cp)
+				return cp;
+
+			uint32_t upper_parity = ((cp >= 0x139 && cp <= 0x148) || cp >= 0x179) ? 1 : 0;
+			return ((cp & 1) != upper_parity) ? cp - 1 : cp;
+		}
+
+		if (cp >= 0x3AC && cp <= 0x3CE)
+		{
+			if (0x3C2 == cp)
+				return 0x3A3;
+
+			if (cp >= 0x3B1 && cp <= 0x3CB)
+				return cp - 0x20;
+
+			if (0x3AC == cp)
+				return 0x386;
+
+			if (cp >= 0x3AD && cp <= 0x3AF)
+				return cp - 0x25;
+
+			if (0x3CC == cp)
+				return 0x38C;
+
+			if (0x3CD == cp || 0x3CE == cp)
+				return cp - 0x3F;
+
+			return cp;
+		}
+
+		if (cp >= 0x430 && cp < 0x530)
+		{
+			if (cp < 0x450)
+				return cp - 0x20;
+
+			if (cp < 0x460)
+				return cp - 0x50;
+
+			if (0x4CF == cp)
+				return 0x4C0;
+
+			if (cp >= 0x4C1 && cp <= 0x4CE)
+				return (cp & 1) ? cp : cp - 1;
+
+			if ((cp >= 0x460 && cp <= 0x481) || cp >= 0x48A)
+				return (cp & 1) ? cp - 1 : cp;
+
+			return cp;
+		}
+
+		if (cp >= 0x561 && cp <= 0x586)
+			return cp - 0x30;
+
+		if ((cp >= 0x1E00 && cp <= 0x1E95) || (cp >= 0x1EA0 && cp <= 0x1EFF))
+			return (cp & 1) ? cp - 1 : cp;
+
+		if (cp >= 0xFF41 && cp <= 0xFF5A)
+			return cp - 0x20;
+
+		if (cp >= 0x10428 && cp <= 0x1044F)
+			return cp - 0x28;
+
+		return cp;
+	}
+
+	bool isWhitespace(char32_t code_point) noexcept
+	{
+		if (code_point < 0x80)
+			return (0x20 == code_point || (code_point >= 0x09 && code_point <= 0x0D));
+
+		switch (code_point)
+		{
+		case 0x85:
+		case 0xA0:
+		case 0x1680:
+		case 0x2028:
+		case 0x2029:
+		case 0x202F:
+		case 0x205F:
+		case 0x3000:
+			return true;
+		default:
+			return (code_point >= 0x2000 && code_point <= 0x200A);
+		}
+	}
+
+	namespace
+	{
+		/**
+		 * @internal
+		 * @brief
+		 *  The unicode character type used to process char_t strings.  char strings are
+		 *  processed as bytes, but are not decoded.
+		 */
+		template<Character char_t>
+		using process_unit_t = std::conditional_t<
+			std::same_as<char_t, char>, char8_t, unicode_unit_t<char_t>
+		>;
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Value past the unicode range given to a single code unit that is part of an
+		 *  invalid sequence, or that is not ASCII in a string that is not decoded.  These
+		 *  values have no case mapping, are not whitespace, and sort after code points.
+		 */
+		constexpr char32_t UndecodedBase = MaxCodePoint + 1;
+
+		/**
+		 * @internal
+		 * @brief
+		 *  The code point at the start of <i>str</i>.
+		 */
+		template<bool decode_units, UnicodeCharacter char_t>
+		Decoded next(const char_t* str, size_t remaining) noexcept
+		{
+			char32_t unit = static_cast<uint32_t>(str[0]);
+
+			if (unit < 0x80)
+				return { unit, 1 };
+
+			if constexpr ( decode_units )
+			{
+				Decoded decoded = decode(str, remaining);
+
+				if (0 != decoded.length)
+					return decoded;
+			}
+
+			return { UndecodedBase + unit, 1 };
+		}
+
+		char32_t mapCase(char32_t code_point, Case target) noexcept
+		{
+			return (Case::Lower == target) ? toLower(code_point) : toUpper(code_point);
+		}
+
+		char32_t foldCase(char32_t code_point) noexcept
+		{
+			return toLower(toUpper(code_point));
+		}
+
+	#if defined(STD_EXT_SSE2)
+		template<UnicodeCharacter char_t>
+		bool isAscii128(__m128i units) noexcept
+		{
+			__m128i high_bits = _mm_and_si128(units, nonAsciiMask128<char_t>());
+			return 0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi8(high_bits, _mm_setzero_si128()));
+		}
+
+		/**
+		 * @internal
+		 * @brief
+		 *  Sets all bits of the 8 or 16 bit ASCII units that are letters of the case
+		 *  opposite of <i>target</i>.
+		 */
+		template<UnicodeCharacter char_t>
+		__m128i asciiLetters128(__m128i units, Case target) noexcept
+		{
+			char first = (Case::Lower == target) ? 'A' : 'a';
+
+			if constexpr (sizeof(char_t) == 1)
+			{
+				return _mm_and_si128(
+					_mm_cmpgt_epi8(units, _mm_set1_epi8(first - 1)),
+					_mm_cmplt_epi8(units, _mm_set1_epi8(first + 26))
+				);
+			}
+			else
+			{
+				return _mm_and_si128(
+					_mm_cmpgt_epi16(units, _mm_set1_epi16(first - 1)),
+					_mm_cmplt_epi16(units, _mm_set1_epi16(first + 26))
+				);
+			}
+		}
+
+		template<UnicodeCharacter char_t>
+		__m128i asciiConvertCase128(__m128i units, Case target) noexcept
+		{
+			__m128i case_bit = (sizeof(char_t) == 1) ? _mm_set1_epi8(0x20) : _mm_set1_epi16(0x20);
+			return _mm_xor_si128(units, _mm_and_si128(asciiLetters128<char_t>(units, target), case_bit));
+		}
+	#endif
+
+		/*
+		 * Each of the following processes 16 bytes of ASCII at a time with SSE2 for 8 and
+		 * 16 bit code units.  When a block contains other characters, the code points in
+		 * that block are processed individually.
+		 */
+
+		template<UnicodeCharacter char_t, bool decode_units>
+		size_t caseChangeOffset(const char_t* data, size_t count, Case target) noexcept
+		{
+			size_t index = 0;
+
+			while (index < count)
+			{
+				size_t scalar_end = count;
+
+			#if defined(STD_EXT_SSE2)
+				if constexpr (sizeof(char_t) <= 2)
+				{
+					constexpr size_t step = sizeof(__m128i) / sizeof(char_t);
+
+					if (index + step <= count)
+					{
+						__m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+
+						if ( isAscii128<char_t>(units) )
+						{
+							uint32_t changes = _mm_movemask_epi8(asciiLetters128<char_t>(units, target));
+
+							if (0 != changes)
+								return index + std::countr_zero(changes) / sizeof(char_t);
+
+							index += step;
+							continue;
+						}
+
+						scalar_end = index + step;
+					}
+				}
+			#endif
+
+				while (index < scalar_end)
+				{
+					Decoded decoded = next<decode_units>(data + index, count - index);
+
+					if (mapCase(decoded.codePoint, target) != decoded.codePoint)
+						return index;
+
+					index += decoded.length;
+				}
+			}
+
+			return std::basic_string_view<char_t>::npos;
+		}
+
+		template<UnicodeCharacter char_t, bool decode_units>
+		void convertCaseUnits(const char_t* data, size_t count, char_t* out, Case target) noexcept
+		{
+			size_t index = 0;
+
+			while (index < count)
+			{
+				size_t scalar_end = count;
+
+			#if defined(STD_EXT_SSE2)
+				if constexpr (sizeof(char_t) <= 2)
+				{
+					constexpr size_t step = sizeof(__m128i) / sizeof(char_t);
+
+					if (index + step <= count)
+					{
+						__m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+
+						if ( isAscii128<char_t>(units) )
+						{
+							_mm_storeu_si128(
+								reinterpret_cast<__m128i*>(out + index),
+								asciiConvertCase128<char_t>(units, target)
+							);
+
+							index += step;
+							continue;
+						}
+
+						scalar_end = index + step;
+					}
+				}
+			#endif
+
+				while (index < scalar_end)
+				{
+					Decoded decoded = next<decode_units>(data + index, count - index);
+					char32_t mapped = mapCase(decoded.codePoint, target);
+
+					if (mapped != decoded.codePoint)
+					{
+						// Mappings never change the encoded length.
+						encode(mapped, out + index);
+					}
+					else if (out != data)
+					{
+						for (uint32_t i = 0; i < decoded.length; ++i)
+							out[index + i] = data[index + i];
+					}
+
+					index += decoded.length;
+				}
+			}
+		}
+
+		template<UnicodeCharacter char_t, bool decode_units>
+		std::strong_ordering compareFolded(
+			const char_t* left, size_t left_count,
+			const char_t* right, size_t right_count
+		) noexcept
+		{
+			size_t left_index = 0;
+			size_t right_index = 0;
+
+			while (left_index < left_count && right_index < right_count)
+			{
+			#if defined(STD_EXT_SSE2)
+				if constexpr (sizeof(char_t) <= 2)
+				{
+					constexpr size_t step = sizeof(__m128i) / sizeof(char_t);
+
+					if (left_index + step <= left_count && right_index + step <= right_count)
+					{
+						__m128i left_units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + left_index));
+						__m128i right_units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + right_index));
+
+						if ( isAscii128<char_t>(_mm_or_si128(left_units, right_units)) )
+						{
+							__m128i left_lower = asciiConvertCase128<char_t>(left_units, Case::Lower);
+							__m128i right_lower = asciiConvertCase128<char_t>(right_units, Case::Lower);
+
+							uint32_t differences = 0xFFFF & ~static_cast<uint32_t>(
+								_mm_movemask_epi8(_mm_cmpeq_epi8(left_lower, right_lower))
+							);
+
+							if (0 == differences)
+							{
+								left_index += step;
+								right_index += step;
+								continue;
+							}
+
+							size_t offset = std::countr_zero(differences) / sizeof(char_t);
+
+							return toLower(static_cast<uint32_t>(left[left_index + offset])) <=>
+								toLower(static_cast<uint32_t>(right[right_index + offset]));
+						}
+					}
+				}
+			#endif
+
+				Decoded left_decoded = next<decode_units>(left + left_index, left_count - left_index);
+				Decoded right_decoded = next<decode_units>(right + right_index, right_count - right_index);
+
+				char32_t left_folded = foldCase(left_decoded.codePoint);
+				char32_t right_folded = foldCase(right_decoded.codePoint);
+
+				if (left_folded != right_folded)
+					return left_folded <=> right_folded;
+
+				left_index += left_decoded.length;
+				right_index += right_decoded.length;
+			}
+
+			return (left_count - left_index) <=> (right_count - right_index);
+		}
+
+		template<UnicodeCharacter char_t, bool decode_units>
+		size_t leadingWhitespaceUnits(const char_t* data, size_t count) noexcept
+		{
+			size_t index = 0;
+
+			while (index < count)
+			{
+				Decoded decoded = next<decode_units>(data + index, count - index);
+
+				if ( !isWhitespace(decoded.codePoint) )
+					break;
+
+				index += decoded.length;
+			}
+
+			return index;
+		}
+
+		template<UnicodeCharacter char_t, bool decode_units>
+		size_t trailingWhitespaceUnits(const char_t* data, size_t count) noexcept
+		{
+			size_t end = count;
+
+			while (end > 0)
+			{
+				size_t start = end - 1;
+
+				if constexpr ( decode_units && sizeof(char_t) == 1 )
+				{
+					while (start > 0 && end - start < 4 && isContinuation(data[start]))
+						--start;
+				}
+				else if constexpr ( decode_units && sizeof(char_t) == 2 )
+				{
+					if (start > 0 && data[start] >= 0xDC00 && data[start] <= 0xDFFF)
+						--start;
+				}
+
+				Decoded decoded = next<decode_units>(data + start, end - start);
+
+				// A sequence that does not decode to exactly the remaining units is not
+				// whitespace.
+				if ( start + decoded.length != end || !isWhitespace(decoded.codePoint) )
+				{
+					break;
+				}
+
+				end = start;
+			}
+
+			return count - end;
+		}
+
+		template<Character char_t>
+		auto processView(std::basic_string_view<char_t> str) noexcept
+		{
+			using unit_t = process_unit_t<char_t>;
+			return std::basic_string_view<unit_t>(reinterpret_cast<const unit_t*>(str.data()), str.size());
+		}
+	}
+
+	template<Character char_t>
+	size_t findCaseChange(std::basic_string_view<char_t> str, Case target) noexcept
+	{
+		using unit_t = process_unit_t<char_t>;
+		auto units = processView(str);
+
+		return caseChangeOffset<unit_t, !std::same_as<char_t, char>>(
+			units.data(), units.size(), target
+		);
+	}
+
+	template<Character char_t>
+	void convertCase(std::basic_string_view<char_t> str, char_t* out, Case target) noexcept
+	{
+		using unit_t = process_unit_t<char_t>;
+		auto units = processView(str);
+
+		convertCaseUnits<unit_t, !std::same_as<char_t, char>>(
+			units.data(), units.size(), reinterpret_cast<unit_t*>(out), target
+		);
+	}
+
+	template<Character char_t>
+	std::strong_ordering caseInsensitiveCompare(
+		std::basic_string_view<char_t> left,
+		std::basic_string_view<char_t> right
+	) noexcept
+	{
+		using unit_t = process_unit_t<char_t>;
+		auto left_units = processView(left);
+		auto right_units = processView(right);
+
+		return compareFolded<unit_t, !std::same_as<char_t, char>>(
+			left_units.data(), left_units.size(), right_units.data(), right_units.size()
+		);
+	}
+
+	template<Character char_t>
+	size_t leadingWhitespace(std::basic_string_view<char_t> str) noexcept
+	{
+		using unit_t = process_unit_t<char_t>;
+		auto units = processView(str);
+
+		return leadingWhitespaceUnits<unit_t, !std::same_as<char_t, char>>(units.data(), units.size());
+	}
+
+	template<Character char_t>
+	size_t trailingWhitespace(std::basic_string_view<char_t> str) noexcept
+	{
+		using unit_t = process_unit_t<char_t>;
+		auto units = processView(str);
+
+		return trailingWhitespaceUnits<unit_t, !std::same_as<char_t, char>>(units.data(), units.size());
+	}
+
+	template size_t findCaseChange<char>(std::string_view, Case) noexcept;
+	template size_t findCaseChange<char8_t>(std::u8string_view, Case) noexcept;
+	template size_t findCaseChange<char16_t>(std::u16string_view, Case) noexcept;
+	template size_t findCaseChange<char32_t>(std::u32string_view, Case) noexcept;
+
+	template void convertCase<char>(std::string_view, char*, Case) noexcept;
+	template void convertCase<char8_t>(std::u8string_view, char8_t*, Case) noexcept;
+	template void convertCase<char16_t>(std::u16string_view, char16_t*, Case) noexcept;
+	template void convertCase<char32_t>(std::u32string_view, char32_t*, Case) noexcept;
+
+	template std::strong_ordering caseInsensitiveCompare<char>(std::string_view, std::string_view) noexcept;
+	template std::strong_ordering caseInsensitiveCompare<char8_t>(std::u8string_view, std::u8string_view) noexcept;
+	template std::strong_ordering caseInsensitiveCompare<char16_t>(std::u16string_view, std::u16string_view) noexcept;
+	template std::strong_ordering caseInsensitiveCompare<char32_t>(std::u32string_view, std::u32string_view) noexcept;
+
+	template size_t leadingWhitespace<char>(std::string_view) noexcept;
+	template size_t leadingWhitespace<char8_t>(std::u8string_view) noexcept;
+	template size_t leadingWhitespace<char16_t>(std::u16string_view) noexcept;
+	template size_t leadingWhitespace<char32_t>(std::u32string_view) noexcept;
+
+	template size_t trailingWhitespace<char>(std::string_view) noexcept;
+	template size_t trailingWhitespace<char8_t>(std::u8string_view) noexcept;
+	template size_t trailingWhitespace<char16_t>(std::u16string_view) noexcept;
+	template size_t trailingWhitespace<char32_t>(std::u32string_view) noexcept;
+}
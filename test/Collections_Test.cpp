@@ -3,6 +3,7 @@
 #include <StdExt/Collections/Collections.h>
 #include <StdExt/Collections/SharedArray.h>
 #include <StdExt/Collections/Vector.h>
+#include <StdExt/Memory/Arena.h>
 #include <StdExt/String.h>
 
 #include "TestClasses.h"
@@ -345,6 +346,47 @@ void testCollections()
 					test_vec[4].id() == 4;
 			}
 		);
+
+		testByCheck(
+			"Copies of a vector do not share elements, and moves take heap storage.",
+			[]()
+			{
+				Vector<int, 2> original(8, 3);
+				Vector<int, 2> copy = original;
+
+				copy[0] = 4;
+
+				const int* storage = original.data();
+				Vector<int, 2> moved = std::move(original);
+
+				return original.size() == 0 && moved.data() == storage &&
+					moved[0] == 3 && copy[0] == 4 && copy.size() == 8;
+			}
+		);
+
+		testByCheck(
+			"Vector storage that is not local comes from its allocator.",
+			[]()
+			{
+				MonotonicArena arena;
+				Vector<int, 2> vec(arena);
+
+				vec.resize(2, 1);
+				bool local_unused = (0 == arena.bytesUsed());
+
+				for (int i = 0; i < 100; ++i)
+					vec.emplace_back(i);
+
+				bool in_arena = (arena.bytesUsed() >= vec.size() * sizeof(int));
+
+				Vector<int, 2> moved = std::move(vec);
+				Vector<int, 2> copy = moved;
+
+				return local_unused && in_arena && &moved.allocator() == &arena &&
+					&copy.allocator() == &Allocator::heap() && moved.size() == 102 &&
+					moved[101] == 99 && copy[101] == 99;
+			}
+		);
 	}
 #	pragma endregion
 
@@ -406,6 +448,188 @@ void testCollections()
 			"Copy constructor used to create elements after the first element.",
 			shared_string_array[0].data(), shared_string_array[3].data()
 		);
+
+		std::vector<int> owned_ints{ 5, 6, 7, 8 };
+		const int* owned_data = owned_ints.data();
+
+		SharedArray<int> adopted_ints = SharedArray<int>::adopt(
+			std::move(owned_ints),
+			[](std::vector<int>& owner)
+			{
+				return std::span<int>(owner);
+			}
+		);
+
+		testByCheck(
+			"SharedArray::adopt() uses the elements of the owner without copying.",
+			[&]()
+			{
+				return
+					adopted_ints.data() == owned_data &&
+					adopted_ints.size() == 4 &&
+					adopted_ints[3] == 8;
+			}
+		);
+
+		int delete_count = 0;
+
+		{
+			SharedArray<int> adopted_raw = SharedArray<int>::adopt(
+				new int[3]{ 1, 2, 3 }, 3,
+				[&](int* ptr)
+				{
+					delete[] ptr;
+					++delete_count;
+				}
+			);
+
+			SharedArray<int> adopted_copy = adopted_raw;
+		}
+
+		testForResult<int>(
+			"SharedArray::adopt() calls the deleter once when the last reference is released.",
+			1, delete_count
+		);
+
+		testByCheck(
+			"SharedArray::isUnique() is only true for the single reference to a block.",
+			[]()
+			{
+				SharedArray<int> array(2, 0);
+				bool unique_alone = array.isUnique();
+
+				SharedArray<int> copy = array;
+				bool unique_shared = array.isUnique() || copy.isUnique();
+
+				copy.makeNull();
+
+				return unique_alone && !unique_shared && array.isUnique() &&
+					!SharedArray<int>().isUnique();
+			}
+		);
+
+		testByCheck(
+			"SharedArray::makeUnique() copies shared elements and leaves unique ones in place.",
+			[]()
+			{
+				SharedArray<int> array(3, 4);
+				SharedArray<int> copy = array;
+
+				copy.makeUnique();
+				copy[0] = 5;
+
+				const int* unique_data = copy.data();
+				copy.makeUnique();
+
+				return copy.isUnique() && array.isUnique() &&
+					copy.data() == unique_data && array[0] == 4 &&
+					copy[0] == 5 && copy[2] == 4;
+			}
+		);
+
+		testByCheck(
+			"SharedArray::resize() keeps elements and grows capacity geometrically.",
+			[]()
+			{
+				SharedArray<int> array;
+				size_t allocations = 0;
+				const int* last_data = nullptr;
+
+				for (int i = 0; i < 1000; ++i)
+				{
+					array.resize(array.size() + 1, i);
+
+					if (array.data() != last_data)
+					{
+						last_data = array.data();
+						++allocations;
+					}
+				}
+
+				for (int i = 0; i < 1000; ++i)
+				{
+					if (array[i] != i)
+						return false;
+				}
+
+				return array.size() == 1000 && array.capacity() >= 1000 && allocations <= 11;
+			}
+		);
+
+		testByCheck(
+			"SharedArray::resize() on a shared array does not change other references.",
+			[]()
+			{
+				SharedArray<String> array(2, String(u8"A string too long for local storage."));
+				SharedArray<String> copy = array;
+
+				copy.resize(3, String::literal(u8"third"));
+				array.resize(1);
+
+				return array.size() == 1 && copy.size() == 3 &&
+					copy[0] == copy[1] && copy[2] == String::literal(u8"third") &&
+					array[0] == copy[0];
+			}
+		);
+
+		testByCheck(
+			"SharedArray with LocalRefCount shares and copies elements like the atomic policy.",
+			[]()
+			{
+				SharedArray<int, LocalRefCount> array(3, 7);
+				SharedArray<int, LocalRefCount> copy = array;
+
+				bool shared = (copy.data() == array.data() && !array.isUnique());
+
+				copy.resize(4, 8);
+
+				return shared && array.isUnique() && copy.isUnique() &&
+					array.size() == 3 && copy.size() == 4 && copy[2] == 7 && copy[3] == 8;
+			}
+		);
+
+		testByCheck(
+			"SharedArray::reserve() copies adopted elements before growing.",
+			[]()
+			{
+				int deletes = 0;
+
+				SharedArray<int> array = SharedArray<int>::adopt(
+					new int[2]{ 1, 2 }, 2,
+					[&](int* ptr)
+					{
+						delete[] ptr;
+						++deletes;
+					}
+				);
+
+				array.reserve(8);
+
+				return deletes == 1 && array.size() == 2 && array.capacity() == 8 &&
+					array[0] == 1 && array[1] == 2;
+			}
+		);
+
+		testByCheck(
+			"SharedArray allocated from an allocator keeps using it as it grows and is copied.",
+			[]()
+			{
+				MonotonicArena arena;
+
+				SharedArray<int> array(arena, 4, 5);
+				size_t used = arena.bytesUsed();
+
+				array.resize(64, 6);
+
+				SharedArray<int> copy = array;
+				copy.makeUnique();
+
+				return used > 4 * sizeof(int) && arena.bytesUsed() > used &&
+					&array.allocator() == &arena && &copy.allocator() == &arena &&
+					&SharedArray<int>(4).allocator() == &Allocator::heap() &&
+					copy.size() == 64 && copy[3] == 5 && copy[63] == 6;
+			}
+		);
 	}
 #	pragma endregion
 }
\ No newline at end of file
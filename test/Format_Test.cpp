@@ -0,0 +1,184 @@
+#include <StdExt/Format.h>
+
+#include <StdExt/Matrix.h>
+#include <StdExt/Number.h>
+#include <StdExt/String.h>
+#include <StdExt/Vec.h>
+
+#include <StdExt/Test/Test.h>
+
+#include <array>
+#include <limits>
+#include <string>
+
+using namespace StdExt;
+using namespace StdExt::Test;
+
+void testFormat()
+{
+	testForResult<String>(
+		"format: Literal text without placeholders is unchanged.",
+		String::literal(u8"No placeholders"), format(u8"No placeholders")
+	);
+
+	testForResult<String>(
+		"format: Integers of different widths and signs.",
+		String::literal(u8"-12 34 18446744073709551615 -128"),
+		format(
+			u8"{} {} {} {}",
+			-12, 34u, std::numeric_limits<uint64_t>::max(), std::numeric_limits<int8_t>::min()
+		)
+	);
+
+	testForResult<String>(
+		"format: Floating point values use the shortest round-trip text.",
+		String::literal(u8"0.1 2.5 1e+20 -0.3"),
+		format(u8"{} {} {} {}", 0.1, 2.5f, 1e20, -0.3)
+	);
+
+	testForResult<String>(
+		"format: bool and character arguments.",
+		String::literal(u8"true/false/x"),
+		format(u8"{}/{}/{}", true, false, u8'x')
+	);
+
+	testForResult<String>(
+		"format: String, view, std::string, and literal arguments.",
+		String::literal(u8"one two three four"),
+		format(
+			u8"{} {} {} {}",
+			String::literal(u8"one"), std::u8string_view(u8"two"), std::u8string(u8"three"), u8"four"
+		)
+	);
+
+	testForResult<String>(
+		"format: Escaped braces are written as single braces.",
+		String::literal(u8"{5} }{"),
+		format(u8"{{{}}} }}{{", 5)
+	);
+
+	testForResult<String>(
+		"format: Number arguments are written according to their stored type.",
+		String::literal(u8"-7, 7, 7.25"),
+		format(u8"{}, {}, {}", Number(-7), Number(7u), Number(7.25))
+	);
+
+	testForResult<String>(
+		"format: Vec arguments are written as comma separated components.",
+		String::literal(u8"(1, 2) (0.5, 1.5, 2.5) (1, -2, 3, -4)"),
+		format(
+			u8"({}) ({}) ({})",
+			Vec2<int32_t>(1, 2), Vec3<float64_t>(0.5, 1.5, 2.5), Vec4<float32_t>(1.0f, -2.0f, 3.0f, -4.0f)
+		)
+	);
+
+	testForResult<String>(
+		"format: Matrix arguments are written as bracketed columns.",
+		String::literal(u8"[1, 0], [0, 1]"),
+		format(u8"{}", Matrix2x2<int32_t>())
+	);
+
+	testForResult<String>(
+		"format: Matrix4x4 arguments are written as bracketed columns.",
+		String::literal(u8"[1, 0, 0, 0], [0, 1, 0, 0], [0, 0, 1, 0], [0, 0, 0, 1]"),
+		format(u8"{}", Matrix4x4<float32_t>::Identity())
+	);
+
+	testForResult<U16String>(
+		"format: Wide format strings widen numeric text.",
+		U16String::literal(u"x = 42, y = 1.5"),
+		format(u"x = {}, y = {}", 42, 1.5)
+	);
+
+	testByCheck(
+		"format: Small results are stored locally.",
+		[]()
+		{
+			String result = format(u8"{}-{}", 1, 2);
+			return !result.isOnHeap() && result == String::literal(u8"1-2");
+		}
+	);
+
+	testByCheck(
+		"format: Large results are written into a single null-terminated allocation.",
+		[]()
+		{
+			String result = format(
+				u8"The quick brown {} jumps over the lazy {} {} times.",
+				String::literal(u8"fox"), String::literal(u8"dog"), 1000
+			);
+
+			return result.isOnHeap() && result.isNullTerminated() &&
+				result == String::literal(u8"The quick brown fox jumps over the lazy dog 1000 times.");
+		}
+	);
+
+	testForException<format_error>(
+		"format: More placeholders than arguments throws format_error.",
+		[]()
+		{
+			format(u8"{} {}", 1);
+		}
+	);
+
+	testForException<format_error>(
+		"format: Fewer placeholders than arguments throws format_error.",
+		[]()
+		{
+			format(u8"{}", 1, 2);
+		}
+	);
+
+	testForException<format_error>(
+		"format: An unmatched brace throws format_error.",
+		[]()
+		{
+			format(u8"value: {", 1);
+		}
+	);
+
+	testForException<format_error>(
+		"format: Placeholders with format specifications are not supported.",
+		[]()
+		{
+			format(u8"{:x}", 1);
+		}
+	);
+
+	testByCheck(
+		"toChars: Writes formatted text to a caller supplied buffer.",
+		[]()
+		{
+			std::array<char8_t, 32> buffer;
+			char8_t* end = toChars(buffer.data(), buffer.data() + buffer.size(), Vec2<int32_t>(-3, 4));
+
+			return std::u8string_view(buffer.data(), end - buffer.data()) == u8"-3, 4" &&
+				formattedSize(Vec2<int32_t>(-3, 4)) == 5;
+		}
+	);
+
+	testForException<std::out_of_range>(
+		"toChars: Throws when the text does not fit in the buffer.",
+		[]()
+		{
+			std::array<char, 4> buffer;
+			toChars(buffer.data(), buffer.data() + buffer.size(), 123456);
+		}
+	);
+
+	testByCheck(
+		"Number::toString() round-trips through Number::parse().",
+		[]()
+		{
+			std::array<float64_t, 5> values = { 0.1, -3.3, 1e20, 123456789.125, 2.5e-300 };
+
+			for (float64_t value : values)
+			{
+				if ( Number::parse(Number(value).toString()).value<float64_t>() != value )
+					return false;
+			}
+
+			return Number(-42).toString() == String::literal(u8"-42");
+		}
+	);
+}
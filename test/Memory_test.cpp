@@ -1,16 +1,30 @@
 #include "TestClasses.h"
 
+#include <StdExt/Buffer.h>
 
+#include <StdExt/Memory/AllocTracking.h>
+#include <StdExt/Memory/Arena.h>
 #include <StdExt/Memory/BitMask.h>
 #include <StdExt/Memory/Endianess.h>
+#include <StdExt/Memory/IntrusivePtr.h>
+#include <StdExt/Memory/ObjectPool.h>
 #include <StdExt/Memory/SharedData.h>
 #include <StdExt/Memory/SharedPtr.h>
 
 #include <StdExt/Test/Test.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
 #include <string>
 #include <cstdint>
+#include <source_location>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace std;
 using namespace StdExt;
@@ -21,6 +35,42 @@ class alignas(32) HighAlign
 	char mData[32];
 };
 
+class IntrusiveNode : public IntrusiveRefCounted<IntrusiveNode>
+{
+public:
+	static inline int liveCount = 0;
+
+	int value;
+	IntrusivePtr<IntrusiveNode> next;
+
+	IntrusiveNode(int node_value)
+		: value(node_value)
+	{
+		++liveCount;
+	}
+
+	~IntrusiveNode()
+	{
+		--liveCount;
+	}
+};
+
+class LocalIntrusiveValue : public IntrusiveRefCounted<LocalIntrusiveValue, LocalRefCount>
+{
+public:
+	int value = 0;
+};
+
+struct DestructCountMetadata
+{
+	static inline int destructCount = 0;
+
+	~DestructCountMetadata()
+	{
+		++destructCount;
+	}
+};
+
 void testMemory()
 {
 	constexpr uint32_t test_uint_bits = 0x695A279C;
@@ -81,6 +131,91 @@ void testMemory()
 			"StdExt::SharedData reports nullptr after makeNull() call.",
 			true, nullptr == shared_data.data()
 		);
+
+		testByCheck(
+			"StdExt::SharedData with LocalRefCount frees the block with the last reference.",
+			[]()
+			{
+				DestructCountMetadata::destructCount = 0;
+
+				SharedData<DestructCountMetadata, LocalRefCount> local_data(8);
+				SharedData<DestructCountMetadata, LocalRefCount> local_copy = local_data;
+
+				local_data.makeNull();
+				bool kept = (0 == DestructCountMetadata::destructCount && local_copy.data() != nullptr);
+
+				local_copy.makeNull();
+				return kept && 1 == DestructCountMetadata::destructCount;
+			}
+		);
+
+		testByCheck(
+			"StdExt::SharedDataView subviews share the parent block, which outlives the SharedData.",
+			[]()
+			{
+				DestructCountMetadata::destructCount = 0;
+
+				SharedData<DestructCountMetadata> data(64);
+				const uint8_t* start = static_cast<const uint8_t*>(data.data());
+
+				SharedDataView<DestructCountMetadata> whole = data;
+				SharedDataView<DestructCountMetadata> header = whole.subview(0, 16);
+				SharedDataView<DestructCountMetadata> body = whole.subview(16);
+				SharedDataView<DestructCountMetadata> field = body.subview(8, 4);
+
+				bool ranges =
+					header.data() == start && header.size() == 16 &&
+					body.data() == start + 16 && body.size() == 48 &&
+					field.data() == start + 24 && field.offset() == 24 && field.size() == 4;
+
+				data.makeNull();
+				whole.makeNull();
+				header.makeNull();
+				body.makeNull();
+
+				bool kept = (0 == DestructCountMetadata::destructCount && field.metadata() != nullptr);
+
+				field.makeNull();
+				return ranges && kept && 1 == DestructCountMetadata::destructCount;
+			}
+		);
+
+		testForException<std::out_of_range>(
+			"StdExt::SharedDataView::subview() throws when the range is outside the view.",
+			[]()
+			{
+				SharedDataView<> view(SharedData<>(32), 8, 16);
+				view.subview(10, 8);
+			}
+		);
+
+		testByCheck(
+			"StdExt::SharedDataView::span() gives typed access to the viewed bytes.",
+			[]()
+			{
+				SharedData<> data(32, alignof(uint32_t));
+				SharedDataView<> view(data, 8, 16);
+
+				std::span<uint32_t> values = view.span<uint32_t>();
+
+				for (size_t i = 0; i < values.size(); ++i)
+					values[i] = static_cast<uint32_t>(i + 1);
+
+				const uint32_t* raw = static_cast<const uint32_t*>(data.data());
+
+				return values.size() == 4 && raw[2] == 1 && raw[5] == 4 &&
+					std::as_const(view).span<uint32_t>().data() == raw + 2;
+			}
+		);
+
+		testForException<invalid_operation>(
+			"StdExt::SharedDataView::span() throws if the view is not aligned for the type.",
+			[]()
+			{
+				SharedDataView<> view(SharedData<>(32, alignof(uint32_t)), 1, 8);
+				view.span<uint32_t>();
+			}
+		);
 	}
 #	pragma endregion
 	
@@ -224,6 +359,242 @@ void testMemory()
 			"StdExt::can_place_aligned<T>() failure parameters. (No guarentee of enough space after alignemnt.)",
 			false, can_place_aligned<HighAlign>(40, 16)
 		);
+
+		testByCheck(
+			"StdExt::alloc_aligned() and realloc_aligned() keep alignment and contents across sizes.",
+			[]()
+			{
+				constexpr std::array<size_t, 4> alignments = { 1, 8, 16, 64 };
+				constexpr std::array<size_t, 7> sizes = { 1, 24, 100, 500, 1000, 3000, 70000 };
+
+				for (size_t alignment : alignments)
+				{
+					for (size_t size : sizes)
+					{
+						auto ptr = static_cast<uint8_t*>(alloc_aligned(size, alignment));
+
+						if ( reinterpret_cast<uintptr_t>(ptr) % alignment != 0 )
+							return false;
+
+						for (size_t i = 0; i < size; ++i)
+							ptr[i] = static_cast<uint8_t>(i);
+
+						size_t grown_size = 2 * size + 7;
+						ptr = static_cast<uint8_t*>(realloc_aligned(ptr, grown_size, alignment));
+
+						if ( reinterpret_cast<uintptr_t>(ptr) % alignment != 0 )
+							return false;
+
+						for (size_t i = 0; i < size; ++i)
+						{
+							if ( ptr[i] != static_cast<uint8_t>(i) )
+								return false;
+						}
+
+						ptr[grown_size - 1] = 1;
+						ptr = static_cast<uint8_t*>(realloc_aligned(ptr, size / 2 + 1, alignment));
+
+						if ( ptr[size / 2] != static_cast<uint8_t>(size / 2) )
+							return false;
+
+						free_aligned(ptr);
+					}
+				}
+
+				return true;
+			}
+		);
+
+		testByCheck(
+			"StdExt::free_aligned() accepts memory allocated on another thread.",
+			[]()
+			{
+				std::vector<void*> allocations(1000);
+
+				std::thread(
+					[&]()
+					{
+						for (size_t i = 0; i < allocations.size(); ++i)
+							allocations[i] = alloc_aligned(16 + i % 200, 8);
+					}
+				).join();
+
+				AllocPoolStats before = alloc_pool_stats();
+
+				for (void* allocation : allocations)
+					free_aligned(allocation);
+
+				for (size_t i = 0; i < allocations.size(); ++i)
+					allocations[i] = alloc_aligned(16 + i % 200, 8);
+
+				for (void* allocation : allocations)
+					free_aligned(allocation);
+
+				AllocPoolStats after = alloc_pool_stats();
+
+				if constexpr ( Config::PooledAlloc )
+				{
+					return after.pooledDeallocations - before.pooledDeallocations == 2000 &&
+						after.pooledAllocations - before.pooledAllocations == 1000 &&
+						after.batchTransfers > before.batchTransfers;
+				}
+				else
+				{
+					return 0 == after.pooledAllocations && 0 == after.slabCount;
+				}
+			}
+		);
+
+		testByCheck(
+			"StdExt::free_aligned() returns blocks to their own size class after the thread cache is destroyed.",
+			[]()
+			{
+				struct FreeAtExit
+				{
+					void* ptr = nullptr;
+
+					~FreeAtExit()
+					{
+						free_aligned(ptr);
+					}
+				};
+
+				void* allocation = nullptr;
+
+				std::thread(
+					[&]()
+					{
+						allocation = alloc_aligned(500, 8);
+					}
+				).join();
+
+				AllocPoolStats before = alloc_pool_stats();
+
+				std::thread(
+					[&]()
+					{
+						// Constructed before the thread cache, so it is destroyed after it.
+						thread_local FreeAtExit late_free;
+						late_free.ptr = allocation;
+
+						free_aligned(alloc_aligned(1000, 8));
+					}
+				).join();
+
+				AllocPoolStats after = alloc_pool_stats();
+
+				if constexpr ( Config::PooledAlloc )
+				{
+					// The free blocks of the second thread all go to the largest class.  The
+					// late free is found by the change in the other classes, since headers
+					// added by STD_EXT_TRACK_ALLOC can move it past the class of 500 bytes.
+					size_t changed_classes = 0;
+					size_t size_class = 0;
+
+					for (size_t i = 0; i + 1 < AllocPoolStats::SizeClassCount; ++i)
+					{
+						if ( after.globalFreeBlocks[i] != before.globalFreeBlocks[i] )
+						{
+							++changed_classes;
+							size_class = i;
+						}
+					}
+
+					return 1 == changed_classes && after.classSizes[size_class] >= 500 &&
+						after.globalFreeBlocks[size_class] == before.globalFreeBlocks[size_class] + 1 &&
+						after.pooledDeallocations == before.pooledDeallocations + 2;
+				}
+				else
+				{
+					return 0 == after.globalFreeBlocks[0] && 0 == after.classSizes[0];
+				}
+			}
+		);
+
+		testByCheck(
+			"alloc_tracking_stats() attributes allocations, reallocations and frees to their call sites.",
+			[]()
+			{
+				const std::source_location alloc_site = std::source_location::current();
+				const std::source_location realloc_site = std::source_location::current();
+
+				auto findSite = [](const AllocTrackingStats& stats, const std::source_location& location)
+				{
+					for (const AllocSiteStats& site : stats.sites)
+					{
+						if ( site.file && site.line == location.line() && 0 == strcmp(site.file, location.file_name()) )
+							return site;
+					}
+
+					return AllocSiteStats{};
+				};
+
+				AllocTrackingStats before = alloc_tracking_stats();
+
+				std::array<void*, 3> blocks{};
+
+				for (void*& block : blocks)
+					block = alloc_aligned(100, 8, alloc_site);
+
+				blocks[0] = realloc_aligned(blocks[0], 300, 8, realloc_site);
+
+				AllocTrackingStats during = alloc_tracking_stats();
+
+				std::thread(
+					[&]()
+					{
+						free_aligned(blocks[1]);
+					}
+				).join();
+
+				free_aligned(blocks[0]);
+				free_aligned(blocks[2]);
+
+				AllocTrackingStats after = alloc_tracking_stats();
+
+				if constexpr ( Config::TrackAlloc )
+				{
+					AllocSiteStats alloc_stats = findSite(after, alloc_site);
+					AllocSiteStats realloc_stats = findSite(after, realloc_site);
+
+					return alloc_stats.allocations == 3 && alloc_stats.deallocations == 3 &&
+						alloc_stats.bytesAllocated == 300 && alloc_stats.liveBytes() == 0 &&
+						realloc_stats.allocations == 1 && realloc_stats.deallocations == 1 &&
+						realloc_stats.bytesAllocated == 300 &&
+						during.liveBytes >= before.liveBytes + 500 &&
+						after.reallocations - before.reallocations >= 1 &&
+						after.sizeHistogram[7] - before.sizeHistogram[7] >= 3 &&
+						after.sizeHistogram[9] - before.sizeHistogram[9] >= 1;
+				}
+				else
+				{
+					return 0 == after.allocations && 0 == after.peakBytes && after.sites.empty();
+				}
+			}
+		);
+
+		testByCheck(
+			"alloc_tracking_stats() reports peaks of live bytes reached between snapshots.",
+			[]()
+			{
+				AllocTrackingStats before = alloc_tracking_stats();
+
+				// Large enough that live bytes pass the previous peak while it is held.
+				size_t size = before.peakBytes + 4096;
+				free_aligned(alloc_aligned(size, 8));
+
+				AllocTrackingStats after = alloc_tracking_stats();
+
+				if constexpr ( Config::TrackAlloc )
+				{
+					return after.peakBytes >= before.liveBytes + size;
+				}
+				else
+				{
+					return 0 == after.peakBytes && 0 == after.liveBytes;
+				}
+			}
+		);
 	}
 #	pragma endregion
 
@@ -804,6 +1175,499 @@ void testMemory()
 			"SharedPtr: Base pointer of non-polymorphic subclass calls actual object's destructor.",
 			destruct_test, true
 		);
+
+		testByCheck(
+			"SharedPtr: Copies of the same type keep the object alive.",
+			[]()
+			{
+				bool destroyed = false;
+
+				SharedPtr<NonVirtualSub> ptr = SharedPtr<NonVirtualSub>::make(&destroyed);
+				SharedPtr<NonVirtualSub> copy = ptr;
+				SharedPtr<NonVirtualSub> assigned;
+				assigned = copy;
+
+				ptr.clear();
+				copy.clear();
+				bool kept = !destroyed && assigned.get() != nullptr;
+
+				assigned.clear();
+				return kept && destroyed;
+			}
+		);
+
+		testByCheck(
+			"makeShared: Forwards arguments to the constructor of the object.",
+			[]()
+			{
+				auto ptr = makeShared<std::unique_ptr<int>>(std::make_unique<int>(5));
+				return ptr.useCount() == 1 && **ptr == 5;
+			}
+		);
+
+		testForResult<bool>(
+			"makeShared: Objects are aligned to the alignment of their type.",
+			true, 0 == reinterpret_cast<uintptr_t>(makeShared<HighAlign>().get()) % alignof(HighAlign)
+		);
+
+		testByCheck(
+			"WeakPtr: lock() returns the object while a SharedPtr references it.",
+			[]()
+			{
+				auto ptr = makeShared<int>(12);
+				WeakPtr<int> weak = ptr;
+
+				SharedPtr<int> locked = weak.lock();
+
+				return !weak.expired() && locked.get() == ptr.get() && ptr.useCount() == 2;
+			}
+		);
+
+		testByCheck(
+			"WeakPtr: The object is destroyed with the last SharedPtr and lock() returns null.",
+			[]()
+			{
+				bool destroyed = false;
+
+				SharedPtr<NonVirtualBase> ptr = makeShared<NonVirtualSub>(&destroyed);
+				WeakPtr<NonVirtualBase> weak = ptr;
+				WeakPtr<NonVirtualBase> weak_copy = weak;
+
+				ptr.clear();
+
+				return destroyed && weak.expired() && weak_copy.expired() &&
+					!weak.lock() && !weak_copy.lock();
+			}
+		);
+
+		testByCheck(
+			"WeakPtr: LocalRefCount weak pointers expire with the object.",
+			[]()
+			{
+				WeakPtr<int, LocalRefCount> weak;
+
+				{
+					auto ptr = makeShared<int, LocalRefCount>(3);
+					weak = ptr;
+
+					if ( weak.expired() || *weak.lock() != 3 )
+						return false;
+				}
+
+				return weak.expired() && !weak.lock() && WeakPtr<int>().expired();
+			}
+		);
+
+		testByCheck(
+			"SharedPtr: LocalRefCount pointers destroy the object with the last reference.",
+			[]()
+			{
+				bool destroyed = false;
+
+				SharedPtr<NonVirtualBase, LocalRefCount> base_ptr =
+					SharedPtr<NonVirtualSub, LocalRefCount>::make(&destroyed);
+				SharedPtr<NonVirtualBase, LocalRefCount> copy = base_ptr;
+
+				base_ptr.clear();
+				bool kept = !destroyed;
+
+				copy.clear();
+				return kept && destroyed;
+			}
+		);
+	}
+#	pragma endregion
+
+#	pragma region IntrusivePtr
+	{
+		testByCheck(
+			"IntrusivePtr: makeIntrusive() adopts the initial reference, and copies add references.",
+			[]()
+			{
+				IntrusiveNode::liveCount = 0;
+
+				IntrusivePtr<IntrusiveNode> node = makeIntrusive<IntrusiveNode>(1);
+				bool adopted = (1 == node->referenceCount());
+
+				IntrusivePtr<IntrusiveNode> copy = node;
+				bool copied = (2 == node->referenceCount() && copy == node);
+
+				node.clear();
+				bool kept = (1 == IntrusiveNode::liveCount && 1 == copy->referenceCount());
+
+				copy.clear();
+				return adopted && copied && kept && 0 == IntrusiveNode::liveCount;
+			}
+		);
+
+		testByCheck(
+			"IntrusivePtr: Releasing the head of a chain of nodes deletes the whole chain.",
+			[]()
+			{
+				IntrusiveNode::liveCount = 0;
+
+				IntrusivePtr<IntrusiveNode> head = makeIntrusive<IntrusiveNode>(0);
+				IntrusiveNode* tail = head.get();
+
+				for (int i = 1; i < 10; ++i)
+				{
+					tail->next = makeIntrusive<IntrusiveNode>(i);
+					tail = tail->next.get();
+				}
+
+				bool built = (10 == IntrusiveNode::liveCount && 9 == tail->value);
+				head.clear();
+
+				return built && 0 == IntrusiveNode::liveCount;
+			}
+		);
+
+		testByCheck(
+			"IntrusivePtr: Constructing from a raw pointer adds a reference, and release() and adopt() transfer one.",
+			[]()
+			{
+				IntrusivePtr<IntrusiveNode> node = makeIntrusive<IntrusiveNode>(3);
+
+				IntrusivePtr<IntrusiveNode> from_raw(node.get());
+				bool added = (2 == node->referenceCount());
+
+				IntrusiveNode* raw = from_raw.release();
+				bool released = (!from_raw && 2 == node->referenceCount());
+
+				IntrusivePtr<IntrusiveNode> adopted = IntrusivePtr<IntrusiveNode>::adopt(raw);
+
+				return added && released && 2 == node->referenceCount() && adopted == node;
+			}
+		);
+
+		testByCheck(
+			"IntrusivePtr: LocalRefCount objects are counted and deleted the same way.",
+			[]()
+			{
+				auto value = makeIntrusive<LocalIntrusiveValue>();
+				auto copy = value;
+				copy->value = 5;
+
+				return 2 == value->referenceCount() && 5 == value->value;
+			}
+		);
+
+		testForException<null_pointer>(
+			"IntrusivePtr: Dereferencing a null pointer throws null_pointer.",
+			[]()
+			{
+				IntrusivePtr<IntrusiveNode> node;
+				*node;
+			}
+		);
+
+		testByCheck(
+			"TaggedIntrusivePtr: Packs a counted reference and a tag in a single word.",
+			[]()
+			{
+				IntrusiveNode::liveCount = 0;
+
+				{
+					TaggedIntrusivePtr<uint8_t, IntrusiveNode> tagged(7, makeIntrusive<IntrusiveNode>(11));
+					TaggedIntrusivePtr<uint8_t, IntrusiveNode> copy = tagged;
+
+					copy.setTag(9);
+
+					if ( 2 != tagged->referenceCount() || 7 != tagged.tag() || 9 != copy.tag() ||
+					     11 != copy->value || copy.toIntrusivePtr().get() != tagged.get() )
+					{
+						return false;
+					}
+
+					tagged.setPtr(makeIntrusive<IntrusiveNode>(12));
+
+					if ( 1 != copy->referenceCount() || 12 != tagged->value || 7 != tagged.tag() )
+						return false;
+				}
+
+				return 0 == IntrusiveNode::liveCount;
+			}
+		);
+	}
+#	pragma endregion
+
+#	pragma region MonotonicArena
+	{
+		testByCheck(
+			"MonotonicArena allocations are aligned and packed into a single block.",
+			[]()
+			{
+				MonotonicArena arena;
+
+				auto first = reinterpret_cast<uintptr_t>(arena.allocate(3, 1));
+				auto second = reinterpret_cast<uintptr_t>(arena.allocate(8, 8));
+				auto third = reinterpret_cast<uintptr_t>(arena.allocate(32, 32));
+
+				return second % 8 == 0 && third % 32 == 0 &&
+					second >= first + 3 && third >= second + 8 &&
+					arena.bytesUsed() == 43 && arena.capacity() == MonotonicArena::DefaultBlockSize;
+			}
+		);
+
+		testByCheck(
+			"MonotonicArena chains blocks large enough for allocations bigger than the block size.",
+			[]()
+			{
+				MonotonicArena arena(256);
+
+				arena.allocate(200, 8);
+				void* large = arena.allocate(1000, 64);
+
+				return reinterpret_cast<uintptr_t>(large) % 64 == 0 &&
+					arena.bytesUsed() == 1200 && arena.capacity() >= 1256;
+			}
+		);
+
+		testByCheck(
+			"MonotonicArena::deallocate() reclaims only the most recent allocation.",
+			[]()
+			{
+				MonotonicArena arena;
+
+				void* first = arena.allocate(64, 8);
+				void* second = arena.allocate(64, 8);
+
+				arena.deallocate(first, 64, 8);
+				arena.deallocate(second, 64, 8);
+
+				return arena.bytesUsed() == 64 && arena.allocate(64, 8) == second;
+			}
+		);
+
+		testByCheck(
+			"MonotonicArena::reset() keeps only the largest block and release() frees all blocks.",
+			[]()
+			{
+				MonotonicArena arena(256);
+
+				for (int i = 0; i < 16; ++i)
+					arena.allocate(100, 8);
+
+				size_t grown_capacity = arena.capacity();
+				arena.reset();
+
+				bool reset = arena.bytesUsed() == 0 &&
+					arena.capacity() > 0 && arena.capacity() < grown_capacity;
+
+				arena.allocate(100, 8);
+				arena.release();
+
+				return reset && arena.bytesUsed() == 0 && arena.capacity() == 0;
+			}
+		);
+
+		testByCheck(
+			"MonotonicArena::reset() keeps an oversized block that was not the most recent.",
+			[]()
+			{
+				MonotonicArena arena(256);
+
+				arena.allocate(10000, 8);
+				arena.allocate(200, 8);
+				arena.allocate(200, 8);
+
+				size_t grown_capacity = arena.capacity();
+				arena.reset();
+
+				size_t reset_capacity = arena.capacity();
+				void* reused = arena.allocate(9000, 8);
+
+				return reset_capacity >= 10000 && reset_capacity < grown_capacity &&
+					nullptr != reused && arena.capacity() == reset_capacity;
+			}
+		);
+	}
+#	pragma endregion
+
+#	pragma region ObjectPool
+	{
+		testByCheck(
+			"ObjectPool recycles the slot of a destroyed object for the next object created.",
+			[]()
+			{
+				ObjectPool<std::string> pool;
+
+				std::string* first = pool.create("first");
+				bool constructed = (*first == "first");
+
+				pool.destroy(first);
+				std::string* second = pool.create(4, 'x');
+
+				bool recycled = (second == first) && (*second == "xxxx") &&
+					pool.capacity() == Detail::ObjectPoolBase::MagazineSize;
+
+				pool.destroy(second);
+
+				return constructed && recycled;
+			}
+		);
+
+		testByCheck(
+			"ObjectPool::Handle destroys its object when reset or destroyed, and not after release().",
+			[]()
+			{
+				ObjectPool<NonVirtualSub> pool;
+
+				bool reset_destroyed = false;
+				bool scope_destroyed = false;
+				bool release_destroyed = false;
+
+				auto handle = pool.make(&reset_destroyed);
+				auto moved = std::move(handle);
+
+				bool moved_ok = !handle && moved;
+				moved.reset();
+
+				{
+					auto scoped = pool.make(&scope_destroyed);
+				}
+
+				auto released = pool.make(&release_destroyed);
+				NonVirtualSub* raw = released.release();
+
+				bool release_ok = !release_destroyed;
+				pool.destroy(raw);
+
+				return moved_ok && reset_destroyed && scope_destroyed && release_ok && release_destroyed;
+			}
+		);
+
+		testByCheck(
+			"ObjectPool with cache line padding places each object on its own cache line.",
+			[]()
+			{
+				ObjectPool<uint32_t, true> pool;
+
+				auto first = pool.make(1u);
+				auto second = pool.make(2u);
+
+				auto first_address = reinterpret_cast<uintptr_t>(first.get());
+				auto second_address = reinterpret_cast<uintptr_t>(second.get());
+
+				auto distance = (first_address > second_address) ?
+					first_address - second_address : second_address - first_address;
+
+				return first_address % CacheLineSize == 0 && second_address % CacheLineSize == 0 &&
+					distance >= CacheLineSize && *first == 1 && *second == 2;
+			}
+		);
+
+		testByCheck(
+			"ObjectPool objects can be created and destroyed on different threads.",
+			[]()
+			{
+				constexpr size_t ThreadCount = 4;
+				constexpr size_t Rounds = 2000;
+				constexpr size_t Batch = 50;
+
+				ObjectPool<std::array<size_t, 4>> pool;
+				std::atomic<size_t> mismatches = 0;
+
+				std::vector<std::thread> threads;
+
+				for (size_t t = 0; t < ThreadCount; ++t)
+				{
+					threads.emplace_back(
+						[&, t]()
+						{
+							std::vector<std::array<size_t, 4>*> live;
+
+							for (size_t round = 0; round < Rounds; ++round)
+							{
+								for (size_t i = 0; i < Batch; ++i)
+									live.push_back( pool.create(std::array<size_t, 4>{t, round, i, t}) );
+
+								for (size_t i = 0; i < Batch; ++i)
+								{
+									auto& values = *live[i];
+
+									if (values[0] != t || values[1] != round || values[2] != i || values[3] != t)
+										++mismatches;
+
+									pool.destroy(live[i]);
+								}
+
+								live.clear();
+							}
+						}
+					);
+				}
+
+				for (auto& thread : threads)
+					thread.join();
+
+				std::vector<ObjectPool<std::array<size_t, 4>>::Handle> handles;
+
+				std::thread producer(
+					[&]()
+					{
+						for (size_t i = 0; i < 1000; ++i)
+							handles.push_back( pool.make(std::array<size_t, 4>{i, i, i, i}) );
+					}
+				);
+
+				producer.join();
+
+				for (size_t i = 0; i < handles.size(); ++i)
+				{
+					if ( (*handles[i])[0] != i )
+						++mismatches;
+				}
+
+				handles.clear();
+
+				return 0 == mismatches && pool.capacity() <= 2 * (ThreadCount * Batch + 1000);
+			}
+		);
+	}
+#	pragma endregion
+
+#	pragma region Buffer
+	{
+		testByCheck(
+			"Buffer::resize() keeps contents and alignment when growing past and shrinking below a megabyte.",
+			[]()
+			{
+				constexpr std::array<size_t, 5> sizes = { 1000, 2 * 1024 * 1024, 2 * 1024 * 1024 + 100, 5 * 1024 * 1024, 1000 };
+
+				Buffer buffer(sizes[0], 64);
+				size_t filled = sizes[0];
+
+				auto bytes = [&]() { return static_cast<uint8_t*>(buffer.data()); };
+
+				for (size_t i = 0; i < filled; ++i)
+					bytes()[i] = static_cast<uint8_t>(i * 3);
+
+				for (size_t size : sizes)
+				{
+					buffer.resize(size);
+
+					if ( buffer.size() != size || reinterpret_cast<uintptr_t>(buffer.data()) % 64 != 0 )
+						return false;
+
+					for (size_t i = 0; i < std::min(filled, size); ++i)
+					{
+						if ( bytes()[i] != static_cast<uint8_t>(i * 3) )
+							return false;
+					}
+
+					for (size_t i = filled; i < size; ++i)
+						bytes()[i] = static_cast<uint8_t>(i * 3);
+
+					filled = size;
+				}
+
+				Buffer copy;
+				copy = buffer;
+
+				return copy.size() == buffer.size() && 0 == memcmp(copy.data(), buffer.data(), copy.size());
+			}
+		);
 	}
 #	pragma endregion
 }
@@ -4,7 +4,9 @@
 #include <StdExt/Utility.h>
 #include <StdExt/Type.h>
 
+#include <array>
 #include <limits>
+#include <string_view>
 
 using namespace StdExt;
 using namespace StdExt::Test;
@@ -315,4 +317,90 @@ void testNumber()
 			Number::clampConvert<uint8_t>(std::numeric_limits<float>::quiet_NaN());
 		}
 	);
+
+	// ---- Number::parse() ----------------------------------------------------------
+
+	testByCheck(
+		"Number::parse stores non-negative integers as uint64_t.",
+		[]()
+		{
+			Number num = Number::parse(u8"18446744073709551615");
+
+			return Type<uint64_t>::index() == num.storedAsIndex() &&
+				std::numeric_limits<uint64_t>::max() == num.value<uint64_t>();
+		}
+	);
+
+	testByCheck(
+		"Number::parse stores negative integers as int64_t, including the lowest int64_t.",
+		[]()
+		{
+			Number num = Number::parse(u8"-9223372036854775808");
+
+			return Type<int64_t>::index() == num.storedAsIndex() &&
+				std::numeric_limits<int64_t>::min() == num.value<int64_t>();
+		}
+	);
+
+	testForResult<uint64_t>(
+		"Number::parse handles long runs of digits and leading zeros.",
+		1234567890123456789ull, Number::parse(u8"00000000001234567890123456789").value<uint64_t>()
+	);
+
+	testByCheck(
+		"Number::parse stores text with a fraction or exponent as float64_t.",
+		[]()
+		{
+			Number fraction = Number::parse(u8"2.0");
+			Number exponent = Number::parse(u8"1e+20");
+
+			return Type<float64_t>::index() == fraction.storedAsIndex() &&
+				Type<float64_t>::index() == exponent.storedAsIndex() &&
+				1e20 == exponent.value<float64_t>();
+		}
+	);
+
+	testForResult<int64_t>(
+		"Number::parse ignores surrounding whitespace and a leading '+'.",
+		42, Number::parse(u8" \t+42\n").value<int64_t>()
+	);
+
+	testForException<std::invalid_argument>(
+		"Number::parse throws invalid_argument on trailing text.",
+		[]()
+		{
+			Number::parse(u8"12abc");
+		}
+	);
+
+	testForException<std::invalid_argument>(
+		"Number::parse throws invalid_argument on empty text.",
+		[]()
+		{
+			Number::parse(u8"  ");
+		}
+	);
+
+	testForException<std::out_of_range>(
+		"Number::parse throws out_of_range when the value does not fit in a float64_t.",
+		[]()
+		{
+			Number::parse(u8"1e400");
+		}
+	);
+
+	testByCheck(
+		"Number::parse batch overload parses each view.",
+		[]()
+		{
+			std::array<std::u8string_view, 3> strings = { u8"7", u8"-7", u8"0.5" };
+			std::array<Number, 3> numbers;
+
+			Number::parse(strings, numbers);
+
+			return 7 == numbers[0].value<int32_t>() &&
+				-7 == numbers[1].value<int32_t>() &&
+				0.5 == numbers[2].value<float64_t>();
+		}
+	);
 }
\ No newline at end of file
@@ -1,3 +1,9 @@
+#include <StdExt/Streams/AsyncFileIO.h>
+#include <StdExt/Streams/BufferedStream.h>
+#include <StdExt/Streams/FdFileStream.h>
+#include <StdExt/Streams/FileStream.h>
+#include <StdExt/Streams/MappedFileStream.h>
+#include <StdExt/Streams/MemoryStream.h>
 #include <StdExt/Streams/SocketStream.h>
 
 #include <StdExt/String.h>
@@ -5,6 +11,15 @@
 
 #include <StdExt/Test/Test.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
 using namespace StdExt;
 using namespace StdExt::Test;
 using namespace StdExt::Streams;
@@ -64,4 +79,572 @@ void testStreams()
 		true, checkStreamIO(ss, ss)
 	);
 
+	testByCheck(
+		"MemoryStream reads the bytes of a SharedDataView in place.",
+		[]()
+		{
+			SharedData<> received(16, alignof(uint32_t));
+			SharedDataView<> message(received);
+
+			std::span<uint32_t> words = message.span<uint32_t>();
+
+			for (size_t i = 0; i < words.size(); ++i)
+				words[i] = static_cast<uint32_t>(100 + i);
+
+			const SharedDataView<> payload = message.subview(4, 8);
+			MemoryStream stream(payload);
+
+			uint32_t first = read<uint32_t>(&stream);
+			uint32_t second = read<uint32_t>(&stream);
+
+			return first == 101 && second == 102 && 0 == stream.bytesAvailable() &&
+				stream.dataPtr(0) == payload.data();
+		}
+	);
+
+	testForException<invalid_operation>(
+		"MemoryStream of a const SharedDataView is read only.",
+		[]()
+		{
+			const SharedDataView<> view(SharedData<>(8));
+			MemoryStream stream(view);
+
+			write<uint32_t>(&stream, 5);
+		}
+	);
+
+	testByCheck(
+		"BufferedStream grows to hold writes larger than its block size.",
+		[]()
+		{
+			BufferedStream stream;
+			std::vector<uint8_t> data(3 * 1024 * 1024 + 5);
+
+			for (size_t i = 0; i < data.size(); ++i)
+				data[i] = static_cast<uint8_t>(i * 7);
+
+			stream.writeRaw(data.data(), 1000);
+			stream.writeRaw(data.data() + 1000, data.size() - 1000);
+			stream.seek(0);
+
+			std::vector<uint8_t> out(data.size());
+			stream.readRaw(out.data(), out.size());
+
+			return out == data;
+		}
+	);
+
+	testByCheck(
+		"BufferedStream writes through a span and releases its buffer trimmed to the data.",
+		[]()
+		{
+			BufferedStream stream;
+			stream.reserve(1000);
+
+			size_t reserved = stream.capacity();
+
+			uint32_t header = 0x01020304;
+			std::span<std::byte> header_span = stream.writeSpan(sizeof(header));
+			memcpy(header_span.data(), &header, sizeof(header));
+
+			std::vector<uint8_t> payload(600, 9);
+			stream.writeRaw(payload.data(), payload.size());
+
+			bool no_growth = reserved >= 1000 && stream.capacity() == reserved;
+
+			Buffer released = stream.release();
+			const uint8_t* bytes = static_cast<const uint8_t*>(released.data());
+
+			bool emptied = 0 == stream.capacity() && 0 == stream.getSeekPosition();
+
+			write<uint32_t>(&stream, header);
+			stream.seek(0);
+
+			return no_growth && emptied && released.size() == sizeof(header) + payload.size() &&
+				0 == memcmp(bytes, &header, sizeof(header)) &&
+				std::equal(payload.begin(), payload.end(), bytes + sizeof(header)) &&
+				header == read<uint32_t>(&stream) && sizeof(header) == stream.getSeekPosition();
+		}
+	);
+
+	testByCheck(
+		"BufferedStream grows geometrically under many small writes.",
+		[]()
+		{
+			BufferedStream stream;
+
+			size_t growth_count = 0;
+			size_t last_capacity = stream.capacity();
+
+			for (size_t i = 0; i < 1024 * 1024; ++i)
+			{
+				write<uint8_t>(&stream, static_cast<uint8_t>(i));
+
+				if (stream.capacity() != last_capacity)
+				{
+					last_capacity = stream.capacity();
+					++growth_count;
+				}
+			}
+
+			return growth_count <= 20 && stream.getSeekPosition() == 1024 * 1024;
+		}
+	);
+
+	const std::filesystem::path mapped_path =
+		std::filesystem::temp_directory_path() / "StdExt_MappedFileStream_Test.bin";
+
+	testByCheck(
+		"MappedFileStream grows a writable file and truncates it to the data written when closed.",
+		[&]()
+		{
+			std::filesystem::remove(mapped_path);
+
+			std::vector<uint8_t> data(200 * 1024 + 3);
+
+			for (size_t i = 0; i < data.size(); ++i)
+				data[i] = static_cast<uint8_t>(i * 13);
+
+			{
+				MappedFileStream stream(String(mapped_path.u8string()), false);
+				stream.adviseAccess(MappedFileStream::AccessHint::Sequential);
+
+				for (size_t written = 0; written < data.size(); written += 1000)
+					stream.writeRaw(data.data() + written, std::min<size_t>(1000, data.size() - written));
+
+				write<uint32_t>(&stream, 0xABCD1234);
+			}
+
+			bool truncated = std::filesystem::file_size(mapped_path) == data.size() + sizeof(uint32_t);
+
+			MappedFileStream stream(String(mapped_path.u8string()), true);
+
+			const uint8_t* in_place = static_cast<const uint8_t*>(stream.dataPtr(0));
+			bool same_in_place = std::equal(data.begin(), data.end(), in_place);
+
+			std::vector<uint8_t> out(data.size());
+			stream.readRaw(out.data(), out.size());
+
+			uint32_t trailer = read<uint32_t>(&stream);
+
+			return truncated && same_in_place && out == data && trailer == 0xABCD1234 &&
+				0 == stream.bytesAvailable() && !stream.canRead(1);
+		}
+	);
+
+	testForException<invalid_operation>(
+		"MappedFileStream opened read only cannot be written.",
+		[&]()
+		{
+			MappedFileStream stream(String(mapped_path.u8string()), true);
+			write<uint32_t>(&stream, 5);
+		}
+	);
+
+	testForException<std::out_of_range>(
+		"MappedFileStream does not read past the end of the file.",
+		[&]()
+		{
+			MappedFileStream stream(String(mapped_path.u8string()), true);
+			stream.seek(stream.size() - 2);
+
+			read<uint32_t>(&stream);
+		}
+	);
+
+	std::filesystem::remove(mapped_path);
+
+	const std::filesystem::path fd_path =
+		std::filesystem::temp_directory_path() / "StdExt_FdFileStream_Test.bin";
+
+	// Errors from file systems that lack sparse files, large files or direct I/O.
+	auto isUnsupported = [](const std::system_error& error)
+	{
+		return EINVAL == error.code().value() || EFBIG == error.code().value();
+	};
+
+	testByCheck(
+		"FdFileStream reads distinct regions of a file from multiple threads.",
+		[&]()
+		{
+			std::filesystem::remove(fd_path);
+
+			constexpr size_t RegionSize = 64 * 1024;
+			constexpr size_t RegionCount = 8;
+
+			std::vector<uint8_t> data(RegionSize * RegionCount);
+
+			for (size_t i = 0; i < data.size(); ++i)
+				data[i] = static_cast<uint8_t>(i * 31);
+
+			FdFileStream stream(String(fd_path.u8string()), false);
+			stream.writeRaw(data.data(), data.size());
+
+			std::vector<uint8_t> out(data.size());
+			std::vector<std::thread> readers;
+
+			for (size_t region = 0; region < RegionCount; ++region)
+			{
+				readers.emplace_back(
+					[&, region]()
+					{
+						stream.readAt(region * RegionSize, out.data() + region * RegionSize, RegionSize);
+					}
+				);
+			}
+
+			for (auto& reader : readers)
+				reader.join();
+
+			return out == data && stream.size() == data.size() &&
+				stream.getSeekPosition() == data.size() && 0 == stream.bytesAvailable();
+		}
+	);
+
+	testByCheck(
+		"FdFileStream reads and writes past 4 GB.",
+		[&]()
+		{
+			constexpr uint64_t FarOffset = 4ull * 1024 * 1024 * 1024 + 16;
+			constexpr uint32_t Marker = 0x5EEDF00D;
+
+			FdFileStream stream(String(fd_path.u8string()), false);
+
+			try
+			{
+				stream.writeAt(FarOffset, &Marker, sizeof(Marker));
+			}
+			catch (const std::system_error& error)
+			{
+				if ( !isUnsupported(error) )
+					throw;
+
+				std::cout << "Note: files larger than 4 GB are not supported in the temporary directory." << std::endl;
+				return true;
+			}
+
+			uint32_t result = 0;
+			size_t read_count = stream.readAt(FarOffset, &result, sizeof(result));
+			size_t past_end = stream.readAt(FarOffset + 2, &result, sizeof(result));
+
+			bool sized = stream.size() == FarOffset + sizeof(Marker);
+			stream.resize(0);
+
+			return read_count == sizeof(Marker) && 2 == past_end && sized && 0 == stream.size();
+		}
+	);
+
+	testForException<std::out_of_range>(
+		"FdFileStream does not read past the end of the file.",
+		[&]()
+		{
+			FdFileStream stream(String(fd_path.u8string()), false);
+			write<uint16_t>(&stream, 5);
+			stream.seek(0);
+
+			read<uint32_t>(&stream);
+		}
+	);
+
+	testByCheck(
+		"FdFileStream::canWrite() grows the file only when asked to.",
+		[&]()
+		{
+			std::filesystem::remove(fd_path);
+
+			FdFileStream stream(String(fd_path.u8string()), false);
+			write<uint32_t>(&stream, 7);
+			stream.seek(0);
+
+			bool fits = stream.canWrite(4);
+			bool past_end = stream.canWrite(8);
+			bool expanded = stream.canWrite(8, true) && stream.size() == 8;
+
+			FdFileStream read_only(String(fd_path.u8string()), true);
+
+			return fits && !past_end && expanded && !read_only.canWrite(1, true);
+		}
+	);
+
+	bool direct_io = true;
+
+	try
+	{
+		FdFileStream probe(String(fd_path.u8string()), true, FdFileStream::DIRECT_IO);
+	}
+	catch (const std::system_error& error)
+	{
+		if ( !isUnsupported(error) )
+			throw;
+
+		std::cout << "Note: direct I/O is not supported in the temporary directory." << std::endl;
+		direct_io = false;
+	}
+
+	if ( direct_io )
+	{
+		testForException<std::invalid_argument>(
+			"FdFileStream opened for direct I/O rejects unaligned reads.",
+			[&]()
+			{
+				FdFileStream stream(String(fd_path.u8string()), true, FdFileStream::DIRECT_IO);
+
+				uint8_t byte;
+				stream.readAt(1, &byte, 1);
+			}
+		);
+	}
+
+	std::filesystem::remove(fd_path);
+
+	const std::filesystem::path async_path =
+		std::filesystem::temp_directory_path() / "StdExt_AsyncFileIO_Test.bin";
+
+	std::vector<AsyncFileIO::Backend> async_backends = { AsyncFileIO::Backend::ThreadPool };
+
+	if ( AsyncFileIO::ioUringAvailable() )
+		async_backends.push_back(AsyncFileIO::Backend::IoUring);
+
+	for (AsyncFileIO::Backend backend : async_backends)
+	{
+		std::string backend_name = (AsyncFileIO::Backend::IoUring == backend) ? "io_uring" : "thread pool";
+
+		testByCheck(
+			"AsyncFileIO on " + backend_name + " writes a batch and reads it back.",
+			[&]()
+			{
+				std::filesystem::remove(async_path);
+
+				constexpr size_t BlockSize = 16 * 1024;
+				constexpr size_t BlockCount = 24;
+
+				AsyncFileIO io(8, backend);
+				FdFileStream file(String(async_path.u8string()), false);
+
+				std::vector<std::future<size_t>> writes;
+
+				{
+					AsyncFileIO::Batch batch(io);
+
+					for (size_t block = 0; block < BlockCount; ++block)
+					{
+						SharedData<> data(BlockSize);
+						memset(data.data(), static_cast<int>(block + 1), BlockSize);
+
+						writes.push_back( batch.write(file, block * BlockSize, SharedDataView<>(data)) );
+					}
+				}
+
+				for (auto& write : writes)
+				{
+					if (write.get() != BlockSize)
+						return false;
+				}
+
+				Buffer whole(BlockSize * BlockCount + 100);
+				size_t whole_read = io.read(file, 0, whole).get();
+
+				std::atomic<size_t> callback_bytes = 0;
+				io.read(
+					file, BlockSize, SharedDataView<>(SharedData<>(BlockSize)),
+					[&](size_t bytes, std::exception_ptr error)
+					{
+						callback_bytes = error ? 0 : bytes;
+					}
+				);
+
+				io.drain();
+
+				const uint8_t* bytes = static_cast<const uint8_t*>(whole.data());
+				bool matches = true;
+
+				for (size_t i = 0; i < BlockSize * BlockCount; ++i)
+					matches = matches && bytes[i] == static_cast<uint8_t>(i / BlockSize + 1);
+
+				return matches && whole_read == BlockSize * BlockCount &&
+					callback_bytes == BlockSize && file.size() == BlockSize * BlockCount &&
+					io.backend() == backend;
+			}
+		);
+
+		testByCheck(
+			"AsyncFileIO on " + backend_name + " completes batches deeper than its submission queue.",
+			[&]()
+			{
+				constexpr size_t RequestCount = 5000;
+
+				AsyncFileIO io(RequestCount, backend);
+				FdFileStream file(String(async_path.u8string()), false);
+
+				SharedData<> data(RequestCount);
+				memset(data.data(), 7, RequestCount);
+
+				std::atomic<size_t> completed = 0;
+
+				{
+					AsyncFileIO::Batch batch(io);
+
+					for (size_t i = 0; i < RequestCount; ++i)
+					{
+						batch.write(
+							file, i, SharedDataView<>(data, i, 1),
+							[&](size_t bytes, std::exception_ptr error)
+							{
+								if (!error && 1 == bytes)
+									++completed;
+							}
+						);
+					}
+				}
+
+				io.drain();
+
+				return completed == RequestCount && file.size() >= RequestCount;
+			}
+		);
+
+		testForException<invalid_operation>(
+			"AsyncFileIO on " + backend_name + " rejects writes to a read only file.",
+			[&]()
+			{
+				AsyncFileIO io(8, backend);
+				FdFileStream file(String(async_path.u8string()), true);
+
+				io.write(file, 0, SharedDataView<>(SharedData<>(16)));
+			}
+		);
+	}
+
+	std::filesystem::remove(async_path);
+
+	const std::filesystem::path vec_path =
+		std::filesystem::temp_directory_path() / "StdExt_VectoredIO_Test.bin";
+
+	auto checkVectored = [](ByteStream& stream)
+		{
+			uint32_t header = 0x11223344;
+			std::vector<uint8_t> payload(3000);
+
+			for (size_t i = 0; i < payload.size(); ++i)
+				payload[i] = static_cast<uint8_t>(i * 7);
+
+			std::array<ConstBuffer, 4> out_buffers = {
+				ConstBuffer{ &header, sizeof(header) },
+				ConstBuffer{ nullptr, 0 },
+				ConstBuffer{ payload.data(), 1000 },
+				ConstBuffer{ payload.data() + 1000, 2000 }
+			};
+
+			stream.writeVec(out_buffers);
+			bool written = stream.getSeekPosition() == sizeof(header) + payload.size();
+
+			stream.seek(0);
+
+			uint32_t header_in = 0;
+			std::vector<uint8_t> payload_in(payload.size());
+
+			std::array<MutableBuffer, 3> in_buffers = {
+				MutableBuffer{ &header_in, sizeof(header_in) },
+				MutableBuffer{ payload_in.data(), 10 },
+				MutableBuffer{ payload_in.data() + 10, payload_in.size() - 10 }
+			};
+
+			stream.readVec(in_buffers);
+
+			return written && header_in == header && payload_in == payload;
+		};
+
+	testByCheck(
+		"BufferedStream gathers writes and scatters reads.",
+		[&]()
+		{
+			BufferedStream stream;
+			return checkVectored(stream);
+		}
+	);
+
+	testByCheck(
+		"SocketStream gathers writes and scatters reads.",
+		[]()
+		{
+			SocketStream stream;
+
+			uint16_t first = 5;
+			std::array<uint8_t, 300> second{};
+			second.fill(9);
+
+			std::array<ConstBuffer, 2> out_buffers = {
+				ConstBuffer{ &first, sizeof(first) },
+				ConstBuffer{ second.data(), second.size() }
+			};
+
+			stream.writeVec(out_buffers);
+
+			uint16_t first_in = 0;
+			std::array<uint8_t, 300> second_in{};
+
+			std::array<MutableBuffer, 2> in_buffers = {
+				MutableBuffer{ &first_in, sizeof(first_in) },
+				MutableBuffer{ second_in.data(), second_in.size() }
+			};
+
+			stream.readVec(in_buffers);
+
+			return first_in == first && second_in == second && 0 == stream.bytesAvailable();
+		}
+	);
+
+	testByCheck(
+		"FileStream gathers writes and scatters reads.",
+		[&]()
+		{
+			std::filesystem::remove(vec_path);
+
+			{
+				// Opening a file that does not exist creates it in append mode.
+				FileStream create(String(vec_path.u8string()), false);
+			}
+
+			FileStream stream(String(vec_path.u8string()), false);
+			return checkVectored(stream);
+		}
+	);
+
+	testByCheck(
+		"FdFileStream gathers writes and scatters reads.",
+		[&]()
+		{
+			std::filesystem::remove(vec_path);
+
+			FdFileStream stream(String(vec_path.u8string()), false);
+			return checkVectored(stream) && stream.size() == sizeof(uint32_t) + 3000;
+		}
+	);
+
+	testByCheck(
+		"MappedFileStream gathers writes and scatters reads through the default implementation.",
+		[&]()
+		{
+			std::filesystem::remove(vec_path);
+
+			MappedFileStream stream(String(vec_path.u8string()), false);
+			return checkVectored(stream);
+		}
+	);
+
+	testForException<std::out_of_range>(
+		"FdFileStream does not scatter reads past the end of the file.",
+		[&]()
+		{
+			FdFileStream stream(String(vec_path.u8string()), true);
+
+			std::vector<uint8_t> too_large(stream.size() + 1);
+			std::array<MutableBuffer, 1> in_buffers = { MutableBuffer{ too_large.data(), too_large.size() } };
+
+			stream.readVec(in_buffers);
+		}
+	);
+
+	std::filesystem::remove(vec_path);
+
 }
\ No newline at end of file
@@ -1,11 +1,18 @@
 #include <StdExt/Test/Test.h>
 
 #include <StdExt/String.h>
+#include <StdExt/StringBuilder.h>
+#include <StdExt/InternedString.h>
+#include <StdExt/Unicode.h>
 #include <StdExt/Compare.h>
 
 #include <StdExt/Concepts.h>
+#include <StdExt/Memory/Arena.h>
 
 #include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace std;
 using namespace StdExt;
@@ -52,6 +59,66 @@ static auto testConversion(const StringBase<in_t>& input)
 	);
 }
 
+template<Character char_t>
+static void testSearch()
+{
+	using string_t = std::basic_string<char_t>;
+	using view_t = std::basic_string_view<char_t>;
+
+	string_t haystack;
+	uint32_t seed = 7;
+
+	for (size_t i = 0; i < 300; ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		haystack += static_cast<char_t>('a' + (seed >> 16) % 6);
+	}
+
+	haystack += static_cast<char_t>(0xE9);
+
+	StringBase<char_t> str(haystack);
+	const view_t view(haystack);
+
+	auto matchesStd = [&](view_t needle)
+	{
+		for (size_t pos = 0; pos <= view.size() + 1; ++pos)
+		{
+			if ( str.find(needle, pos) != view.find(needle, pos) ||
+			     str.findFirstOf(needle, pos) != view.find_first_of(needle, pos) )
+			{
+				return false;
+			}
+
+			if ( needle.size() > 0 && str.find(needle[0], pos) != view.find(needle[0], pos) )
+				return false;
+		}
+
+		return true;
+	};
+
+	Test::testByCheck(
+		std::string("Vectorized search matches std::basic_string_view for ") + charName<char_t>() + ".",
+		[&]()
+		{
+			for (size_t length = 0; length < 40; ++length)
+			{
+				if ( !matchesStd(view.substr(250 - length, length)) )
+					return false;
+			}
+
+			const char_t absent[] = { 'x', 'y', 'z', static_cast<char_t>(0xE9), 'q', 'r', 's', 't', 'u', 'v', 'w', 'f', 'z', 'x' };
+
+			for (size_t length = 1; length <= std::size(absent); ++length)
+			{
+				if ( !matchesStd(view_t(absent, length)) )
+					return false;
+			}
+
+			return matchesStd(view);
+		}
+	);
+}
+
 void testString()
 {
 	String CharString = String::literal(u8"ABCDEFGHIJKLMNOPQRSTUVWXYZ");
@@ -228,4 +295,552 @@ void testString()
 		"since original was also null-terminated.",
 		true, nullTerminated.data() == subStr.data()
 	);
+
+	{
+		U8StringBuilder builder;
+		builder.append(u8"ABC").append(u8'D');
+		builder += U8String(u8"EFG");
+
+		Test::testForResult<bool>(
+			"StringBuilder creates a local string for small results.",
+			true, builder.toString() == std::u8string_view(u8"ABCDEFG") && builder.toString().isLocal()
+		);
+
+		std::u8string expected(u8"ABCDEFG");
+
+		for (size_t i = 0; i < 500; ++i)
+		{
+			builder += LongString;
+			expected += LongString;
+		}
+
+		U8String built = builder.toString();
+
+		Test::testForResult<bool>(
+			"StringBuilder produces the concatenation of all appended data.",
+			true, built == std::u8string_view(expected)
+		);
+
+		Test::testForResult<bool>(
+			"StringBuilder result is stored on the heap and null-terminated.",
+			true, built.isOnHeap() && built.isNullTerminated()
+		);
+
+		Test::testForResult<bool>(
+			"StringBuilder grows chunks geometrically.",
+			true, builder.capacity() < 4 * builder.size()
+		);
+
+		builder.clear();
+
+		Test::testForResult<bool>(
+			"StringBuilder is empty after clear().",
+			true, builder.size() == 0 && builder.toString().size() == 0
+		);
+	}
+
+	testSearch<char>();
+	testSearch<char8_t>();
+	testSearch<char16_t>();
+	testSearch<char32_t>();
+	testSearch<wchar_t>();
+
+	{
+		U8String csv = U8String::literal(u8"alpha,beta,,gamma-delta-epsilon-zeta-eta,");
+		U8String shared_csv = csv + U8String::literal(u8"theta");
+
+		std::vector<U8String> from_view;
+
+		for (const U8String& item : shared_csv.splitView(u8","))
+			from_view.push_back(item);
+
+		Test::testForResult<bool>(
+			"splitView() yields the same substrings as split().",
+			true, from_view == shared_csv.split(u8",")
+		);
+
+		from_view.clear();
+
+		for (const U8String& item : csv.splitView(u8",", false))
+			from_view.push_back(item);
+
+		Test::testForResult<bool>(
+			"splitView() skips empty substrings when keepEmpty is false.",
+			true, from_view == csv.split(u8",", false) && from_view.size() == 3
+		);
+
+		auto long_item = *(++(++(++shared_csv.splitView(u8",").begin())));
+
+		Test::testForResult<bool>(
+			"splitView() substrings share memory with the source string.",
+			true, long_item == std::u8string_view(u8"gamma-delta-epsilon-zeta-eta") &&
+				memory_overlaps(
+					long_item.data(), long_item.size(),
+					shared_csv.data(), shared_csv.size()
+				)
+		);
+
+		Test::testForResult<size_t>(
+			"split() of an empty string with keepEmpty yields one empty string.",
+			1, U8String().split(u8",").size()
+		);
+	}
+
+	{
+		std::u8string std_string(u8"A std::u8string long enough to need heap memory.");
+		const char8_t* std_string_data = std_string.data();
+
+		U8String adopted_std(std::move(std_string));
+		U8String adopted_sub = adopted_std.substr(2, 20);
+
+		Test::testForResult<bool>(
+			"StringBase adopts the memory of a moved std::basic_string.",
+			true, adopted_std.data() == std_string_data &&
+				adopted_sub.data() == std_string_data + 2 &&
+				adopted_std.isNullTerminated()
+		);
+
+		Buffer buffer(64);
+		memset(buffer.data(), 0, buffer.size());
+		memcpy(buffer.data(), u8"Network payload adopted from a Buffer.", 38);
+		const void* buffer_data = buffer.data();
+
+		U8String adopted_buffer = U8String::adopt(std::move(buffer));
+
+		Test::testForResult<bool>(
+			"StringBase::adopt() takes ownership of a Buffer and trims trailing zeros.",
+			true, adopted_buffer.data() == buffer_data &&
+				adopted_buffer == std::u8string_view(u8"Network payload adopted from a Buffer.") &&
+				adopted_buffer.isNullTerminated()
+		);
+
+		int delete_count = 0;
+		auto counting_delete = [&](char8_t* ptr)
+		{
+			delete[] ptr;
+			++delete_count;
+		};
+
+		constexpr std::u8string_view raw_contents(u8"Raw character data without a terminator");
+
+		char8_t* raw = new char8_t[raw_contents.size()];
+		memcpy(raw, raw_contents.data(), raw_contents.size());
+
+		{
+			U8String adopted_raw = U8String::adopt(raw, raw_contents.size(), counting_delete);
+			U8String adopted_raw_sub = adopted_raw.substr(4, 20);
+			adopted_raw = U8String();
+
+			Test::testForResult<bool>(
+				"StringBase::adopt() does not read past unterminated adopted memory.",
+				true, adopted_raw_sub.data() == raw + 4 &&
+					false == U8String::adopt(
+						new char8_t[raw_contents.size()]{}, raw_contents.size(), counting_delete
+					).isNullTerminated()
+			);
+		}
+
+		Test::testForResult<int>(
+			"StringBase::adopt() calls the deleter once all sharing strings are destroyed.",
+			2, delete_count
+		);
+
+		char8_t* small_raw = new char8_t[4]{ u8'a', u8'b', u8'c', u8'd' };
+		U8String adopted_small = U8String::adopt(small_raw, 4, counting_delete);
+
+		Test::testForResult<bool>(
+			"StringBase::adopt() copies small strings and deletes them immediately.",
+			true, adopted_small.isLocal() && adopted_small == std::u8string_view(u8"abcd") && 3 == delete_count
+		);
+	}
+
+	{
+		constexpr const char8_t* identifier = u8"config.routing.primary.output";
+
+		String64 local_64(identifier);
+		String32 local_32(identifier);
+		U8String heap_16(identifier);
+
+		Test::testForResult<bool>(
+			"StringBase stores strings within its small byte size locally.",
+			true, local_64.isLocal() && local_32.isLocal() && heap_16.isOnHeap()
+		);
+
+		U8String long_16 = U8String(LongString) + U8String(LongString) + U8String(LongString);
+		String64 shared_64(long_16);
+		String64 copied_64(heap_16);
+		U8String from_local_64(local_64);
+
+		Test::testForResult<bool>(
+			"Converting between small sizes shares heap memory too large for the target.",
+			true, shared_64.data() == long_16.data() && shared_64 == long_16
+		);
+
+		Test::testForResult<bool>(
+			"Converting between small sizes copies strings that fit in the target locally.",
+			true, copied_64.isLocal() && copied_64 == heap_16
+		);
+
+		Test::testForResult<bool>(
+			"Converting between small sizes allocates only when local data does not fit.",
+			true, from_local_64.isOnHeap() && from_local_64 == local_64
+		);
+
+		String32 literal_32(U8String::literal(identifier));
+
+		Test::testForResult<bool>(
+			"Converting between small sizes keeps literal strings external.",
+			true, literal_32.isExternal() && literal_32.data() == identifier
+		);
+
+		Test::testForResult<bool>(
+			"Converting between small sizes preserves null strings.",
+			true, String32(U8String()).isNull()
+		);
+	}
+
+	{
+		U8String heap_string = U8String(u8"The quick brown fox ") + U8String(u8"jumps over the lazy dog.");
+		U8String sub_string = heap_string.substr(4, 15);
+		U8String literal_string = U8String::literal(u8"The quick brown fox jumps over the lazy dog.");
+
+		Test::testForResult<bool>(
+			"StringBase::hash() is the same for equal strings regardless of storage.",
+			true, heap_string.hash() == literal_string.hash() &&
+				heap_string.hash() == U8String(heap_string.view()).hash() &&
+				sub_string.hash() == U8String(u8"quick brown fox").hash() &&
+				sub_string.hash() == std::hash<U8String>{}(std::u8string_view(u8"quick brown fox"))
+		);
+
+		Test::testByCheck(
+			"hashBytes() produces distinct hashes for distinct inputs of all lengths.",
+			[]()
+			{
+				std::unordered_set<uint64_t> hashes;
+				std::array<uint8_t, 200> bytes{};
+
+				for (size_t length = 0; length < bytes.size(); ++length)
+				{
+					hashes.insert(hashBytes(bytes.data(), length));
+
+					for (size_t bit = 0; bit < 8 && length > 0; ++bit)
+					{
+						bytes[length - 1] ^= static_cast<uint8_t>(1 << bit);
+						hashes.insert(hashBytes(bytes.data(), length));
+						bytes[length - 1] ^= static_cast<uint8_t>(1 << bit);
+					}
+				}
+
+				return hashes.size() == bytes.size() + 8 * (bytes.size() - 1);
+			}
+		);
+
+		std::unordered_map<U8String, int, std::hash<U8String>, std::equal_to<>> string_map;
+		string_map[heap_string] = 1;
+		string_map[sub_string] = 2;
+
+		Test::testForResult<bool>(
+			"StringBase keys in unordered containers can be found using string views.",
+			true, string_map.find(std::u8string_view(u8"quick brown fox"))->second == 2 &&
+				string_map.find(literal_string.view())->second == 1
+		);
+
+	#if defined(STD_EXT_CACHE_STRING_HASH)
+		U8String::shared_array_t memory(heap_string.size() + 1);
+		Collections::copy_n(heap_string.data(), memory.data(), memory.size());
+
+		U8String from_memory(memory);
+		size_t from_memory_hash = from_memory.hash();
+
+		Test::testForResult<bool>(
+			"StringBase::hash() caches the hash in shared memory.",
+			true, from_memory_hash == heap_string.hash() && memory.cachedHash() == from_memory_hash
+		);
+	#endif
+	}
+
+	{
+		U8String heap_key = U8String(u8"signal.routing.") + U8String(u8"primary.output");
+
+		U8InternedString interned_a(heap_key);
+		U8InternedString interned_b(u8"signal.routing.primary.output");
+		U8InternedString interned_c(u8"signal.routing.secondary.output");
+
+		Test::testForResult<bool>(
+			"InternedString handles to equal strings are equal and hash the same.",
+			true, interned_a == interned_b && interned_a.hash() == interned_b.hash()
+		);
+
+		Test::testForResult<bool>(
+			"InternedString handles to different strings are not equal.",
+			true, interned_a != interned_c
+		);
+
+		Test::testForResult<bool>(
+			"Interning a null-terminated heap string shares its memory.",
+			true, interned_b.data() == heap_key.data()
+		);
+
+		U8String from_pool = interned_b.toString();
+
+		Test::testForResult<bool>(
+			"InternedString::toString() shares the pooled memory.",
+			true, from_pool.data() == interned_a.data() && from_pool == heap_key
+		);
+
+		U8StringPool pool;
+		std::vector<U8String> keys;
+
+		for (size_t i = 0; i < 64; ++i)
+			keys.push_back(U8String(u8"config.key.") + U8String(std::u8string(1, u8'A' + (i % 32))));
+
+		std::vector<std::vector<U8InternedString>> per_thread(4);
+		std::vector<std::thread> threads;
+
+		for (auto& handles : per_thread)
+		{
+			threads.emplace_back(
+				[&]()
+				{
+					for (const auto& key : keys)
+						handles.push_back(pool.intern(key));
+				}
+			);
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		Test::testForResult<bool>(
+			"StringPool deduplicates strings interned concurrently.",
+			true, pool.size() == 32 &&
+				per_thread[0] == per_thread[1] &&
+				per_thread[0] == per_thread[2] &&
+				per_thread[0] == per_thread[3]
+		);
+
+		Test::testForResult<bool>(
+			"StringPool::find() returns a null handle for strings not in the pool.",
+			true, pool.find(u8"config.key.missing").isNull() && pool.find(u8"config.key.B") == per_thread[0][1]
+		);
+	}
+
+	{
+		U8String mixed_long =
+			U8String::literal(u8"Plain ASCII text long enough for vector paths. ") +
+			litNonAscii + U8String::literal(u8"\U0001F600 and more ASCII text following the emoji.");
+
+		testConversion<char8_t, char16_t>(mixed_long);
+		testConversion<char8_t, char32_t>(mixed_long);
+		testConversion<char16_t, char32_t>(mixed_long);
+		testConversion<char8_t, wchar_t>(mixed_long);
+
+		Test::testForResult<size_t>(
+			"Unicode::transcodedLength() counts surrogate pairs for UTF-16.",
+			3, Unicode::transcodedLength<char16_t>(std::u8string_view(u8"A\U0001F600"))
+		);
+
+		Test::testForResult<size_t>(
+			"Unicode::transcodedLength() counts multi-byte sequences for UTF-8.",
+			10, Unicode::transcodedLength<char8_t>(std::u32string_view(U"A\u00E9\u4F60\U0001F600"))
+		);
+
+		Test::testForResult<size_t>(
+			"Unicode::asciiLength() finds the first non-ASCII character.",
+			40, Unicode::asciiLength(std::u16string_view(u"0123456789012345678901234567890123456789\u00E9"))
+		);
+
+		const char8_t invalid_utf8[] = u8"0123456789012345678901234567890123456789\xC3(";
+
+		Test::testForResult<size_t>(
+			"Unicode::findInvalid() reports the offset of an invalid sequence.",
+			40, Unicode::findInvalid(std::u8string_view(invalid_utf8))
+		);
+
+		Test::testForResult<size_t>(
+			"Unicode::findInvalid() reports npos for valid strings.",
+			std::u8string_view::npos, Unicode::findInvalid(std::u8string_view(u8"\u4F60\u597D"))
+		);
+
+		const char16_t unpaired_surrogate[] = { u'A', 0xD800, u'B' };
+
+		Test::testForResult<size_t>(
+			"Unicode::findInvalid() rejects unpaired surrogates.",
+			1, Unicode::findInvalid(std::u16string_view(unpaired_surrogate, 3))
+		);
+
+		Test::testForException<Unicode::encoding_error>(
+			"convertString() throws encoding_error for invalid input.",
+			[&]()
+			{
+				convertString<char16_t>(U8String::literal(invalid_utf8));
+			}
+		);
+	}
+
+	{
+		U8String mixed_case = U8String::literal(u8"The Quick Brown Fox Jumps Over The Lazy Dog");
+
+		Test::testForResult<U8String>(
+			"StringBase::toLower() converts ASCII letters.",
+			U8String::literal(u8"the quick brown fox jumps over the lazy dog"), mixed_case.toLower()
+		);
+
+		Test::testForResult<U8String>(
+			"StringBase::toUpper() converts ASCII letters.",
+			U8String::literal(u8"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG"), mixed_case.toUpper()
+		);
+
+		Test::testForResult<U8String>(
+			"StringBase::toUpper() converts Latin, Greek, and Cyrillic letters.",
+			U8String::literal(u8"\u00C9LAN \u0178 \u0141\u00D3D\u0179 \u03A3\u038F\u03A3 \u041F\u0420\u0418\u0412\u0415\u0422"),
+			U8String::literal(u8"\u00E9lan \u00FF \u0142\u00F3d\u017A \u03C3\u03CE\u03C2 \u043F\u0440\u0438\u0432\u0435\u0442").toUpper()
+		);
+
+		Test::testForResult<U16String>(
+			"StringBase::toLower() converts UTF-16 strings, including surrogate pairs.",
+			U16String::literal(u"caf\u00E9 \U00010428 long enough for vectors"),
+			U16String::literal(u"CAF\u00C9 \U00010400 LONG ENOUGH FOR VECTORS").toLower()
+		);
+
+		Test::testForResult<WString>(
+			"StringBase::toUpper() converts wchar_t strings.",
+			WString::literal(L"\u0416\u0423\u041A AND BEETLE"), WString::literal(L"\u0436\u0443\u043A and beetle").toUpper()
+		);
+
+		Test::testForResult<CString>(
+			"StringBase::toUpper() only converts ASCII letters of char strings.",
+			CString::literal("CAF\xC3\xA9 \xE9"), CString::literal("caf\xC3\xA9 \xE9").toUpper()
+		);
+
+		U8String lower_heap(std::u8string_view(u8"already lower case and stored on the heap"));
+
+		Test::testForResult<bool>(
+			"StringBase::toLower() shares memory when nothing changes.",
+			true, lower_heap.toLower().data() == lower_heap.data()
+		);
+
+		U8String shared_heap(std::u8string_view(u8"Shared Memory Must Not Be Modified In Place"));
+		U8String shared_copy = shared_heap;
+		U8String shared_lower = std::move(shared_copy).toLower();
+
+		Test::testForResult<bool>(
+			"StringBase::toLower() copies memory that is shared with another string.",
+			true, shared_lower.data() != shared_heap.data() &&
+				shared_heap == U8String::literal(u8"Shared Memory Must Not Be Modified In Place") &&
+				shared_lower == U8String::literal(u8"shared memory must not be modified in place")
+		);
+
+		U8String unique_heap(std::u8string_view(u8"Uniquely Owned Memory Is Converted In Place"));
+		const char8_t* unique_data = unique_heap.data();
+		U8String unique_upper = std::move(unique_heap).toUpper();
+
+		Test::testForResult<bool>(
+			"StringBase::toUpper() on a uniquely owned rvalue converts in place.",
+			true, unique_upper.data() == unique_data &&
+				unique_upper == U8String::literal(u8"UNIQUELY OWNED MEMORY IS CONVERTED IN PLACE")
+		);
+
+		U8String padded(std::u8string_view(u8" \t\u3000 text surrounded by plenty of whitespace \r\n"));
+		U8String trimmed = padded.trim();
+
+		Test::testForResult<bool>(
+			"StringBase::trim() removes ASCII and unicode whitespace, sharing memory.",
+			true, trimmed == U8String::literal(u8"text surrounded by plenty of whitespace") &&
+				trimmed.data() == padded.data() + 6
+		);
+
+		Test::testForResult<U8String>(
+			"StringBase::trimLeading() only removes leading whitespace.",
+			U8String::literal(u8"text \n"), U8String::literal(u8"\u00A0 text \n").trimLeading()
+		);
+
+		Test::testForResult<U8String>(
+			"StringBase::trimTrailing() only removes trailing whitespace.",
+			U8String::literal(u8"\u00A0 text"), U8String::literal(u8"\u00A0 text \u2003\n").trimTrailing()
+		);
+
+		Test::testForResult<U8String>(
+			"StringBase::trim() of only whitespace is empty.",
+			U8String(), U8String::literal(u8" \t \u2028 ").trim()
+		);
+
+		Test::testForResult<bool>(
+			"StringBase::caseInsensitiveEquals() compares long ASCII strings.",
+			true, mixed_case.caseInsensitiveEquals(u8"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG")
+		);
+
+		Test::testForResult<bool>(
+			"StringBase::caseInsensitiveCompare() orders by folded characters.",
+			true, std::is_lt(U8String::literal(u8"apple").caseInsensitiveCompare(u8"BANANA")) &&
+				std::is_gt(U8String::literal(u8"Zebra").caseInsensitiveCompare(u8"apple")) &&
+				std::is_lt(U8String::literal(u8"abc").caseInsensitiveCompare(u8"ABCD"))
+		);
+
+		Test::testForResult<bool>(
+			"StringBase::caseInsensitiveEquals() folds final sigma and accented letters.",
+			true, U8String::literal(u8"\u03A3\u038A\u03A3\u03A5\u03A6\u039F\u03A3").caseInsensitiveEquals(
+				u8"\u03C3\u03AF\u03C3\u03C5\u03C6\u03BF\u03C2"
+			)
+		);
+	}
+
+	{
+		U8String appended;
+		std::u8string expected;
+		size_t allocations = 0;
+		const char8_t* last_data = nullptr;
+
+		for (size_t i = 0; i < 200; ++i)
+		{
+			appended += LongString;
+			expected += LongString;
+
+			if (appended.data() != last_data)
+			{
+				last_data = appended.data();
+				++allocations;
+			}
+		}
+
+		Test::testForResult<bool>(
+			"StringBase::operator+=() grows uniquely owned heap memory in place.",
+			true, appended == std::u8string_view(expected) && appended.isNullTerminated() && allocations < 20
+		);
+
+		U8String shared = appended;
+		appended += u8"!";
+
+		Test::testForResult<bool>(
+			"StringBase::operator+=() does not modify memory shared with other strings.",
+			true, shared == std::u8string_view(expected) && shared.isNullTerminated() &&
+				appended.size() == shared.size() + 1 && appended.data() != shared.data()
+		);
+
+		U8String self_append(LongString);
+		self_append += self_append;
+
+		Test::testForResult<bool>(
+			"StringBase::operator+=() appends a string to itself.",
+			true, self_append == std::u8string_view(std::u8string(LongString) + std::u8string(LongString))
+		);
+	}
+
+	{
+		MonotonicArena arena;
+
+		U8String small(u8"small", arena);
+		U8String on_arena(LongString, arena);
+		size_t used = arena.bytesUsed();
+
+		U8String shared = on_arena;
+		on_arena += LongString;
+
+		Test::testForResult<bool>(
+			"StringBase constructed with an allocator stores heap memory there and appends to it.",
+			true, !small.isOnHeap() && used > 0 && arena.bytesUsed() > used &&
+				on_arena == std::u8string_view(std::u8string(LongString) + std::u8string(LongString)) &&
+				shared == std::u8string_view(LongString)
+		);
+	}
 }
\ No newline at end of file
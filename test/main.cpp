@@ -10,6 +10,7 @@ extern void testMemory();
 extern void testPredicated();
 extern void testSignals();
 extern void testNumber();
+extern void testFormat();
 extern void testVec();
 extern void testMatrix();
 extern void testSerialize();
@@ -43,6 +44,7 @@ int main()
 	testSerialize();
 	testMatrix();
 	testNumber();
+	testFormat();
 	testSignals();
 	testInPlace();
 	testAny();